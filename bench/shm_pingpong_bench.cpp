@@ -0,0 +1,173 @@
+/**
+ * @brief SoundIpcData 캐시 라인 분리 효과 측정 (프로세스 간 ping-pong)
+ *
+ * fork() 한 두 프로세스가 MAP_SHARED 메모리의 SoundIpcData 를 공유한다.
+ * - pingpong : DCU 가 config(master_volume) 를 기록하면 agent 가 heartbeat 로 응답하고,
+ *              DCU 는 응답을 기다린 뒤 다음 config 를 기록 (왕복 지연)
+ * - polling  : agent 가 heartbeat 를 계속 기록하는 동안 DCU 가 config 를 읽음 (false sharing 시 load 비용)
+ *
+ * legacy(분리 전, 24바이트가 한 캐시 라인) / current(alignas(64)) 레이아웃을 각각 측정한다.
+ *
+ * 사용법: shm_pingpong_bench [rounds] [dcu_cpu] [agent_cpu]
+ *   (기본 rounds=200000, cpu 0 / 1 에 고정. core 가 하나면 고정하지 않고 대기 중 sched_yield)
+ */
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "common/ipc/shared_protocol.hpp"
+#include "common/sync/wait_strategy.hpp"
+
+using namespace GR::LIBCOMMON;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// 분리 전 레이아웃 (Config 8바이트 + Status 16바이트가 같은 캐시 라인)
+struct LegacySoundIpcData {
+    struct Config {
+        std::atomic<uint8_t> master_volume;
+        std::atomic<bool> mute_request;
+        uint8_t reserved[6];
+    };
+
+    struct Status {
+        std::atomic<IPC::SoundState> state;
+        std::atomic<bool> is_active;
+        uint8_t padding[6];
+        std::atomic<uint64_t> heartbeat;
+    };
+
+    Config server_to_client;
+    Status client_to_server;
+};
+
+static_assert(sizeof(LegacySoundIpcData) <= SYNC::CACHE_LINE_SIZE, "legacy layout fits in one cache line");
+
+bool g_single_cpu = false;
+
+inline void relax() {
+    if (g_single_cpu) {
+        sched_yield();
+    } else {
+        SYNC::cpuRelax();
+    }
+}
+
+void pinTo(int cpu) {
+    if (g_single_cpu || cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        std::perror("sched_setaffinity");
+    }
+}
+
+struct Control {
+    std::atomic<uint32_t> phase{0};  // 0: 준비, 1: pingpong, 2: polling, 3: 종료
+    std::atomic<uint32_t> agent_ready{0};
+};
+
+template <typename Layout>
+void runAgent(Layout* data, Control* ctl, long rounds, int cpu) {
+    pinTo(cpu);
+
+    // pingpong: config 변경을 기다렸다가 heartbeat 로 응답
+    while (ctl->phase.load(std::memory_order_acquire) != 1) relax();
+    uint8_t seen = 0;
+    for (long i = 1; i <= rounds; ++i) {
+        uint8_t volume;
+        while ((volume = data->server_to_client.master_volume.load(std::memory_order_acquire)) == seen) relax();
+        seen = volume;
+        data->client_to_server.heartbeat.store(static_cast<uint64_t>(i), std::memory_order_release);
+    }
+
+    // polling: DCU 가 읽는 동안 heartbeat 를 계속 기록
+    while (ctl->phase.load(std::memory_order_acquire) != 2) relax();
+    ctl->agent_ready.store(1, std::memory_order_release);
+    uint64_t beat = 0;
+    while (ctl->phase.load(std::memory_order_relaxed) == 2) {
+        data->client_to_server.heartbeat.store(++beat, std::memory_order_release);
+        if (g_single_cpu && (beat & 0xFF) == 0) sched_yield();
+    }
+}
+
+template <typename Layout>
+void runLayout(const char* name, long rounds, int dcu_cpu, int agent_cpu) {
+    void* mem = mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        std::perror("mmap");
+        std::exit(EXIT_FAILURE);
+    }
+    auto* ctl = new (mem) Control();
+    auto* data = new (static_cast<char*>(mem) + 2 * SYNC::CACHE_LINE_SIZE) Layout();
+
+    const pid_t pid = fork();
+    if (pid == 0) {
+        runAgent(data, ctl, rounds, agent_cpu);
+        _exit(0);
+    }
+    pinTo(dcu_cpu);
+
+    // pingpong
+    std::vector<uint32_t> samples;
+    samples.reserve(static_cast<size_t>(rounds));
+    ctl->phase.store(1, std::memory_order_release);
+    const auto pp_start = Clock::now();
+    for (long i = 1; i <= rounds; ++i) {
+        const auto t0 = Clock::now();
+        // 1..255 순환: 연속한 회차의 값이 항상 달라 agent 가 변화를 감지
+        data->server_to_client.master_volume.store(static_cast<uint8_t>(1 + i % 255), std::memory_order_release);
+        while (data->client_to_server.heartbeat.load(std::memory_order_acquire) != static_cast<uint64_t>(i)) relax();
+        samples.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count()));
+    }
+    const double pp_total_ns = std::chrono::duration<double, std::nano>(Clock::now() - pp_start).count();
+
+    // polling
+    ctl->phase.store(2, std::memory_order_release);
+    while (ctl->agent_ready.load(std::memory_order_acquire) == 0) relax();
+    const long loads = rounds * 100;
+    uint64_t sink = 0;
+    const auto poll_start = Clock::now();
+    for (long i = 0; i < loads; ++i) {
+        sink += data->server_to_client.master_volume.load(std::memory_order_acquire);
+    }
+    const double poll_ns = std::chrono::duration<double, std::nano>(Clock::now() - poll_start).count() / loads;
+    ctl->phase.store(3, std::memory_order_release);
+    waitpid(pid, nullptr, 0);
+
+    std::sort(samples.begin(), samples.end());
+    const auto pct = [&](double p) { return samples[static_cast<size_t>(p * (samples.size() - 1))]; };
+    std::printf("%-8s pingpong: avg %7.1f ns  p50 %6u ns  p99 %7u ns | polling: %5.2f ns/load (sink %lu)\n",
+                name, pp_total_ns / rounds, pct(0.50), pct(0.99), poll_ns, static_cast<unsigned long>(sink & 1));
+
+    munmap(mem, 4096);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long rounds = argc > 1 ? std::atol(argv[1]) : 200000;
+    const int dcu_cpu = argc > 2 ? std::atoi(argv[2]) : 0;
+    const int agent_cpu = argc > 3 ? std::atoi(argv[3]) : 1;
+
+    const unsigned cpus = std::thread::hardware_concurrency();
+    g_single_cpu = cpus <= 1;
+    std::printf("cpus=%u rounds=%ld%s\n", cpus, rounds,
+                g_single_cpu ? " (single cpu: not pinned, waits yield; no cross-core coherence traffic)" : "");
+
+    runLayout<LegacySoundIpcData>("legacy", rounds, dcu_cpu, agent_cpu);
+    runLayout<IPC::SoundIpcData>("current", rounds, dcu_cpu, agent_cpu);
+    return EXIT_SUCCESS;
+}
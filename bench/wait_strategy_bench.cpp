@@ -0,0 +1,98 @@
+/**
+ * @brief SafeQueue WaitStrategy 별 wake-up 지연 측정
+ *
+ * producer 가 interval 마다 현재 시각(steady_clock)을 push 하고, consumer 가 pop 한 시점과의 차이를 기록한다.
+ * BlockingWait / SpinThenFutexWait<4000> / BusySpinWait 각각 p50 / p99 / max 를 출력한다.
+ *
+ * 사용법: wait_strategy_bench [samples] [interval_us] [producer_cpu] [consumer_cpu]
+ *   (기본 samples=20000, interval=20us, cpu 0 / 1 에 고정. core 가 하나면 고정하지 않음)
+ *
+ * @note 단일 core 에서는 SpinThenFutexWait 가 spin 을 생략하고(spinIsUseful), BusySpinWait 는
+ *       producer 의 실행을 빼앗으므로 결과가 의미 없다. 측정은 multi-core 타깃에서 한다.
+ */
+#include <sched.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "common/container/safe_queue.hpp"
+
+using namespace GR::LIBCOMMON;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+bool g_single_cpu = false;
+
+void pinTo(int cpu) {
+    if (g_single_cpu || cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        std::perror("sched_setaffinity");
+    }
+}
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+template <typename WaitStrategy>
+void runStrategy(const char* name, long samples, std::chrono::microseconds interval, int producer_cpu, int consumer_cpu) {
+    SafeQueue<int64_t, WaitStrategy, NoQueueStats, RingStorage> queue;
+    std::vector<int64_t> latencies;
+    latencies.reserve(static_cast<size_t>(samples));
+
+    std::thread consumer([&] {
+        pinTo(consumer_cpu);
+        for (;;) {
+            const int64_t sent = queue.pop();
+            const int64_t received = nowNs();
+            if (sent < 0) break;  // 종료 표시
+            latencies.push_back(received - sent);
+        }
+    });
+
+    pinTo(producer_cpu);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));  // consumer 가 대기 상태에 들어가도록
+    auto next = Clock::now();
+    for (long i = 0; i < samples; ++i) {
+        next += interval;
+        if (g_single_cpu) {
+            std::this_thread::sleep_until(next);
+        } else {
+            while (Clock::now() < next) SYNC::cpuRelax();  // timer slack 없이 일정한 간격 유지
+        }
+        queue.push(nowNs());
+    }
+    queue.push(-1);
+    consumer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto pct = [&](double p) { return latencies[static_cast<size_t>(p * (latencies.size() - 1))] / 1000.0; };
+    std::printf("%-24s p50 %9.2f us  p99 %9.2f us  max %9.2f us\n", name, pct(0.50), pct(0.99), pct(1.0));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long samples = argc > 1 ? std::atol(argv[1]) : 20000;
+    const std::chrono::microseconds interval(argc > 2 ? std::atol(argv[2]) : 20);
+    const int producer_cpu = argc > 3 ? std::atoi(argv[3]) : 0;
+    const int consumer_cpu = argc > 4 ? std::atoi(argv[4]) : 1;
+
+    const unsigned cpus = std::thread::hardware_concurrency();
+    g_single_cpu = cpus <= 1;
+    std::printf("cpus=%u samples=%ld interval=%ldus%s\n", cpus, samples, static_cast<long>(interval.count()),
+                g_single_cpu ? " (single cpu: not pinned, spin phases cannot overlap the producer)" : "");
+
+    runStrategy<SYNC::BlockingWait>("BlockingWait", samples, interval, producer_cpu, consumer_cpu);
+    runStrategy<SYNC::SpinThenFutexWait<4000>>("SpinThenFutexWait<4000>", samples, interval, producer_cpu, consumer_cpu);
+    runStrategy<SYNC::BusySpinWait>("BusySpinWait", samples, interval, producer_cpu, consumer_cpu);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,264 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "common/sync/atomic_words.hpp"
+#include "common/sync/cache_line.hpp"
+#include "common/sync/event_count.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief BroadcastRing 에서 가장 느린 consumer 가 한 바퀴 뒤처졌을 때의 producer 동작
+ */
+enum class BroadcastPolicy : uint8_t {
+    BLOCK     = 0, // 가장 느린 consumer 가 따라올 때까지 publish 대기 (backpressure)
+    OVERWRITE = 1  // 기다리지 않고 덮어씀. 뒤처진 consumer 는 건너뛴 수를 lost 로 집계
+};
+
+/**
+ * @brief single-producer / multi-consumer broadcast 링 (disruptor 방식)
+ *
+ * 모든 consumer 가 각자의 cursor 로 같은 슬롯을 읽으므로, item 을 consumer 수만큼 복사하지 않는다.
+ * (IMU 샘플을 logging / fusion / telemetry 로 분배할 때 SafeQueue 여러 개를 대체)
+ *
+ * @tparam T      저장할 타입 (기본 생성 가능해야 함)
+ * @tparam Policy BLOCK: consumer 는 슬롯을 복사 없이 const T& 로 직접 읽음
+ *                OVERWRITE: 읽는 도중 덮어쓰일 수 있으므로 T 는 trivially copyable 이어야 하며,
+ *                           슬롯을 atomic word 로 저장하고 슬롯별 sequence 로 검증한 복사본을 전달
+ *
+ * 사용 예시:
+ * ```cpp
+ * BroadcastRing<ImuSample> imu_bus(256);
+ * int logger = imu_bus.subscribe();
+ * imu_bus.publish(sample);                                   // producer 스레드
+ * imu_bus.wait_poll(logger, [](const ImuSample& s) { ... }); // consumer 스레드
+ * ```
+ */
+template <typename T, BroadcastPolicy Policy = BroadcastPolicy::BLOCK>
+class BroadcastRing {
+    static_assert(Policy != BroadcastPolicy::OVERWRITE || std::is_trivially_copyable<T>::value,
+                  "BroadcastRing OVERWRITE policy requires trivially copyable T");
+
+public:
+    static constexpr std::size_t DEFAULT_MAX_CONSUMERS = 8;
+
+    /**
+     * @param capacity      슬롯 수 (2의 거듭제곱으로 올림)
+     * @param max_consumers 동시에 구독 가능한 최대 consumer 수
+     */
+    explicit BroadcastRing(std::size_t capacity, std::size_t max_consumers = DEFAULT_MAX_CONSUMERS)
+        : capacity_(roundUpPow2(capacity < 2 ? 2 : capacity))
+        , mask_(capacity_ - 1)
+        , slots_(new Slot[capacity_])
+        , max_consumers_(max_consumers)
+        , cursors_(new Cursor[max_consumers]) {}
+
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+    /**
+     * @brief consumer 등록. 등록 이후 publish 된 item 부터 읽는다.
+     * @return consumer id, 빈 자리가 없으면 -1
+     */
+    int subscribe() {
+        for (std::size_t i = 0; i < max_consumers_; ++i) {
+            bool expected = false;
+            if (cursors_[i].claimed.compare_exchange_strong(expected, true)) {
+                Cursor& c = cursors_[i];
+                c.lost = 0;
+                // active 를 켜기 전에 유효한 위치를 먼저 기록 (producer 가 미확정 cursor 를 보지 않도록)
+                c.next.store(published_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+                c.active.store(true, std::memory_order_seq_cst);
+                // active 가 보이기 전에 producer 가 계산해 둔 gate_ 는 이 시점의 published_ 이하이므로,
+                // 여기서부터 읽으면 아직 덮어쓰이지 않은 슬롯만 읽게 된다
+                c.next.store(published_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    void unsubscribe(int id) {
+        Cursor& c = cursors_[id];
+        c.active.store(false, std::memory_order_seq_cst);
+        c.claimed.store(false, std::memory_order_release);
+        space_.notifyOne();
+    }
+
+    /**
+     * @brief producer 전용. item 을 다음 슬롯에 기록
+     * @return false: stop() 으로 게시되지 않음 (BLOCK 대기 중)
+     */
+    template <typename U>
+    bool publish(U&& item) {
+        const uint64_t seq = published_.load(std::memory_order_relaxed);
+        if (Policy == BroadcastPolicy::BLOCK && !waitForSpace(seq)) return false;
+
+        Slot& slot = slots_[seq & mask_];
+        if constexpr (Policy == BroadcastPolicy::OVERWRITE) {
+            slot.seq.store(seq * 2 + 1, std::memory_order_relaxed); // 기록 중
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.value.store(static_cast<const T&>(item));
+        } else {
+            slot.value = std::forward<U>(item);
+        }
+        slot.seq.store(seq * 2 + 2, std::memory_order_release);
+
+        published_.store(seq + 1, std::memory_order_seq_cst);
+        data_.notifyAll();
+        return true;
+    }
+
+    /**
+     * @brief 대기 없이 읽을 수 있는 item 을 최대 max 개 fn(const T&) 로 전달
+     * @return 처리한 item 수
+     */
+    template <typename F>
+    std::size_t poll(int id, F&& fn, std::size_t max = SIZE_MAX) {
+        Cursor& c = cursors_[id];
+        uint64_t next = c.next.load(std::memory_order_relaxed);
+        const uint64_t end = published_.load(std::memory_order_acquire);
+        std::size_t count = 0;
+
+        if (Policy == BroadcastPolicy::OVERWRITE && end - next > capacity_) {
+            c.lost += end - capacity_ - next;
+            next = end - capacity_;
+        }
+
+        for (; next != end && count < max; ++next) {
+            Slot& slot = slots_[next & mask_];
+            if constexpr (Policy == BroadcastPolicy::BLOCK) {
+                fn(static_cast<const T&>(slot.value));
+                ++count;
+            } else {
+                // OVERWRITE: 복사 후 sequence 가 그대로인지 확인 (per-slot seqlock)
+                T copy;
+                const uint64_t expected = next * 2 + 2;
+                if (slot.seq.load(std::memory_order_acquire) != expected) { ++c.lost; continue; }
+                slot.value.load(copy);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.seq.load(std::memory_order_relaxed) != expected) { ++c.lost; continue; }
+                fn(static_cast<const T&>(copy));
+                ++count;
+            }
+        }
+
+        c.next.store(next, std::memory_order_release);
+        if (Policy == BroadcastPolicy::BLOCK && count > 0) space_.notifyOne();
+        return count;
+    }
+
+    /**
+     * @brief 읽을 item 이 생기거나 stop() 될 때까지 대기 후 poll
+     * @return 처리한 item 수 (stop() 이후 남은 item 이 없으면 0)
+     */
+    template <typename F>
+    std::size_t wait_poll(int id, F&& fn, std::size_t max = SIZE_MAX) {
+        for (;;) {
+            std::size_t n = poll(id, fn, max);
+            if (n > 0) return n;
+            if (!running_.load(std::memory_order_acquire)) return 0;
+
+            uint32_t key = data_.prepareWait();
+            if (available(id) > 0 || !running_.load(std::memory_order_acquire)) {
+                data_.cancelWait();
+                continue;
+            }
+            data_.wait(key);
+        }
+    }
+
+    void stop() {
+        running_.store(false, std::memory_order_release);
+        data_.notifyAll();
+        space_.notifyAll();
+    }
+
+    // consumer 가 아직 읽지 않은 item 수
+    std::size_t available(int id) const {
+        const uint64_t end = published_.load(std::memory_order_acquire);
+        return static_cast<std::size_t>(end - cursors_[id].next.load(std::memory_order_relaxed));
+    }
+
+    // OVERWRITE 정책에서 consumer 가 놓친 item 수 (해당 consumer 스레드에서 조회)
+    uint64_t lost(int id) const { return cursors_[id].lost; }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    // OVERWRITE 는 읽기와 기록이 겹칠 수 있으므로 atomic word 로 저장 (data race 방지)
+    using Payload = std::conditional_t<Policy == BroadcastPolicy::OVERWRITE, SYNC::AtomicWords<T>, T>;
+
+    struct alignas(SYNC::CACHE_LINE_SIZE) Slot {
+        std::atomic<uint64_t> seq{0};
+        Payload value{};
+    };
+
+    struct alignas(SYNC::CACHE_LINE_SIZE) Cursor {
+        std::atomic<uint64_t> next{0};
+        std::atomic<bool> active{false};
+        std::atomic<bool> claimed{false};
+        uint64_t lost = 0; // consumer 스레드 전용
+    };
+
+    static std::size_t roundUpPow2(std::size_t v) {
+        std::size_t p = 1;
+        while (p < v) p <<= 1;
+        return p;
+    }
+
+    // 활성 consumer 중 가장 뒤처진 위치 (없으면 seq)
+    uint64_t slowestCursor(uint64_t seq) const {
+        uint64_t slowest = seq;
+        for (std::size_t i = 0; i < max_consumers_; ++i) {
+            if (cursors_[i].active.load(std::memory_order_seq_cst)) {
+                const uint64_t next = cursors_[i].next.load(std::memory_order_acquire);
+                if (next < slowest) slowest = next;
+            }
+        }
+        return slowest;
+    }
+
+    bool waitForSpace(uint64_t seq) {
+        if (seq - gate_ < capacity_) return true;
+
+        for (int spin = 0; ; ++spin) {
+            gate_ = slowestCursor(seq);
+            if (seq - gate_ < capacity_) return true;
+            if (!running_.load(std::memory_order_acquire)) return false;
+            if (spin < SPIN_LIMIT) continue;
+
+            uint32_t key = space_.prepareWait();
+            gate_ = slowestCursor(seq);
+            if (seq - gate_ < capacity_ || !running_.load(std::memory_order_acquire)) {
+                space_.cancelWait();
+                continue;
+            }
+            space_.wait(key);
+        }
+    }
+
+    static constexpr int SPIN_LIMIT = 64;
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    const std::size_t max_consumers_;
+    std::unique_ptr<Cursor[]> cursors_;
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<uint64_t> published_{0};
+    uint64_t gate_ = 0; // producer 전용: 마지막으로 계산한 가장 느린 cursor 위치
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<bool> running_{true};
+    SYNC::EventCount data_;
+    SYNC::EventCount space_;
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,129 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "common/sync/cache_line.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief Chase-Lev work-stealing deque (Lê et al. 2013, C11 메모리 모델 버전)
+ *
+ * owner 스레드만 push / pop (bottom 쪽, LIFO), 다른 스레드는 steal (top 쪽, FIFO).
+ *
+ * @tparam T trivially copyable 타입 (보통 task 포인터). steal 은 슬롯을 경합 상태로 읽으므로
+ *           복사가 단순 load/store 여야 한다.
+ *
+ * @note 배열이 가득 차면 2배로 늘어난다. 이전 배열은 steal 중인 스레드가 참조할 수 있으므로
+ *       deque 가 파괴될 때 함께 해제한다 (늘어나는 횟수는 log2(최대 크기) 회로 제한됨).
+ */
+template <typename T>
+class ChaseLevDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "ChaseLevDeque requires trivially copyable T");
+
+public:
+    explicit ChaseLevDeque(std::size_t initial_capacity = 256) {
+        std::size_t cap = 2;
+        while (cap < initial_capacity) cap <<= 1;
+        arrays_.emplace_back(new Array(cap));
+        array_.store(arrays_.back().get(), std::memory_order_relaxed);
+    }
+
+    ChaseLevDeque(const ChaseLevDeque&) = delete;
+    ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+    // owner 전용
+    void push(T item) {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_acquire);
+        Array* a = array_.load(std::memory_order_relaxed);
+        if (b - t > static_cast<int64_t>(a->mask)) {
+            a = grow(a, t, b);
+        }
+        a->store(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // owner 전용
+    bool pop(T& out) {
+        const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* a = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = a->load(b);
+        if (t == b) {
+            // 마지막 item: thief 와 경합
+            const bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // 임의 스레드
+    bool steal(T& out) {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) return false;
+
+        Array* a = array_.load(std::memory_order_acquire);
+        T item = a->load(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return false; // 다른 thief 또는 owner 가 가져감
+        }
+        out = item;
+        return true;
+    }
+
+    // 대략적인 크기
+    std::size_t size() const {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Array {
+        explicit Array(std::size_t capacity) : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+        T load(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void store(int64_t i, T v) { slots[i & mask].store(v, std::memory_order_relaxed); }
+
+        const std::size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    Array* grow(Array* old, int64_t t, int64_t b) {
+        arrays_.emplace_back(new Array((old->mask + 1) * 2));
+        Array* fresh = arrays_.back().get();
+        for (int64_t i = t; i < b; ++i) fresh->store(i, old->load(i));
+        array_.store(fresh, std::memory_order_release);
+        return fresh;
+    }
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<int64_t> top_{0};
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<int64_t> bottom_{0};
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<Array*> array_{nullptr};
+    std::vector<std::unique_ptr<Array>> arrays_; // owner 만 변경
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
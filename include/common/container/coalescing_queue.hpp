@@ -0,0 +1,115 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief key 별로 최신 값만 유지하는 FIFO 큐
+ *
+ * 이미 대기 중인 key 로 push 하면 payload 만 교체되고 큐 내 순서는 유지된다.
+ * 따라서 메모리 사용량은 서로 다른 key 수로 제한된다.
+ * (MQTT 단절 중 GPS fix / status 가 backlog 로 쌓이는 것을 방지)
+ *
+ * @tparam Key   topic 등 식별자 (hash 가능해야 함)
+ * @tparam Value payload
+ *
+ * 사용 예시:
+ * ```cpp
+ * CoalescingQueue<std::string, std::string> publish_queue;
+ * publish_queue.push("gps/fix", payload);      // 이전 "gps/fix" 가 남아 있으면 교체
+ * auto [topic, latest] = publish_queue.pop();
+ * ```
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class CoalescingQueue {
+public:
+    /**
+     * @return true: 새 key 로 삽입, false: 대기 중인 key 의 payload 교체
+     */
+    bool push(const Key& key, Value value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = pending_.find(key);
+            if (it != pending_.end()) {
+                it->second = std::move(value);
+                coalesced_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            pending_.emplace(key, std::move(value));
+            order_.push_back(key);
+        }
+        cond_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief 가장 먼저 대기한 key 와 그 최신 값을 꺼냄
+     * stop() 이후 비어있으면 기본 생성된 pair 반환 (SafeQueue::pop 과 동일)
+     */
+    std::pair<Key, Value> pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return !order_.empty() || !running_; });
+        if (order_.empty()) return {};
+        return takeFrontLocked();
+    }
+
+    std::optional<std::pair<Key, Value>> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (order_.empty()) return std::nullopt;
+        return takeFrontLocked();
+    }
+
+    template <typename Rep, typename Period>
+    std::optional<std::pair<Key, Value>> pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cond_.wait_for(lock, timeout, [this] { return !order_.empty() || !running_; })) {
+            return std::nullopt;
+        }
+        if (order_.empty()) return std::nullopt;
+        return takeFrontLocked();
+    }
+
+    void stop() {
+        { std::lock_guard<std::mutex> lock(mutex_); running_ = false; }
+        cond_.notify_all();
+    }
+
+    // 대기 중인 key 수
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return order_.size();
+    }
+
+    // payload 교체로 버려진 이전 값의 수
+    uint64_t coalesced_count() const { return coalesced_.load(std::memory_order_relaxed); }
+
+private:
+    std::pair<Key, Value> takeFrontLocked() {
+        auto it = pending_.find(order_.front());
+        std::pair<Key, Value> item(std::move(order_.front()), std::move(it->second));
+        pending_.erase(it);
+        order_.pop_front();
+        return item;
+    }
+
+    std::unordered_map<Key, Value, Hash> pending_;
+    std::deque<Key> order_;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    bool running_ = true;
+    std::atomic<uint64_t> coalesced_{0};
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
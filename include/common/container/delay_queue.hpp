@@ -0,0 +1,334 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "common/container/ring_buffer.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief DelayQueue::schedule() 이 반환하는 취소용 handle
+ */
+struct TimerId {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool valid() const { return index != UINT32_MAX; }
+};
+
+/**
+ * @brief 계층형 timing wheel 기반 지연 큐
+ *
+ * schedule() 한 item 을 만기 시각에 pop() 으로 꺼낸다. (NTRIP / MQTT 재시도, 사운드 heartbeat 등)
+ *
+ * @note
+ * 1. 4 단계 x 64 슬롯 wheel. 삽입 / 취소 O(1), tick 당 처리 O(1) (상위 단계 cascade 는 분할 상환).
+ * 2. 별도 스레드 없이 pop() 을 호출한 consumer 가 wheel 을 진행시킨다 (단일 driver).
+ * 3. 타이머 node 는 내부 slab 에서 재사용되므로 타이머마다 heap node 를 할당하지 않는다.
+ * 4. 최대 지연은 tick x 64^4 (10ms tick 기준 약 46시간), 초과 시 cascade 하며 재배치된다.
+ *
+ * 사용 예시:
+ * ```cpp
+ * DelayQueue<RetryJob> retries;                       // 10ms tick
+ * TimerId id = retries.schedule(job, std::chrono::seconds(5));
+ * retries.cancel(id);                                 // 연결 성공 시
+ * RetryJob due = retries.pop();                       // 만기된 item
+ * ```
+ */
+template <typename T>
+class DelayQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint32_t SLOTS = 1u << SLOT_BITS;
+
+    explicit DelayQueue(std::chrono::milliseconds tick = std::chrono::milliseconds(10))
+        : tick_(tick.count() > 0 ? tick : std::chrono::milliseconds(1))
+        , start_(Clock::now()) {
+        for (auto& level : heads_) {
+            for (auto& head : level) head = NIL;
+        }
+    }
+
+    DelayQueue(const DelayQueue&) = delete;
+    DelayQueue& operator=(const DelayQueue&) = delete;
+
+    template <typename Rep, typename Period>
+    TimerId schedule(T item, const std::chrono::duration<Rep, Period>& delay) {
+        return schedule_at(std::move(item), Clock::now() + delay);
+    }
+
+    TimerId schedule_at(T item, Clock::time_point due) {
+        TimerId id;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // idle 구간 동안 멈춰 있던 current_tick_ 을 먼저 맞춤 (wheel 이 비어 있으면 O(1)).
+            // 그렇지 않으면 다음 pop() 이 idle 구간 전체를 tick 단위로 진행하게 된다.
+            advanceTo(nowTick());
+
+            // 만기 tick 은 올림: 요청 시각보다 일찍 나가지 않도록
+            const auto since = due - start_;
+            const uint64_t due_tick = since.count() <= 0
+                ? 0 : static_cast<uint64_t>((since + tick_ - Clock::duration(1)) / tick_);
+
+            const uint32_t index = allocNode();
+            Node& node = nodes_[index];
+            node.value.emplace(std::move(item));
+            node.expire = due_tick;
+            place(index);
+
+            id.index = index;
+            id.generation = node.generation;
+            ++pending_;
+        }
+        cond_.notify_one();
+        return id;
+    }
+
+    /**
+     * @return false: 이미 만기되었거나 취소된 타이머
+     */
+    bool cancel(const TimerId& id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!id.valid() || id.index >= nodes_.size()) return false;
+        Node& node = nodes_[id.index];
+        if (node.generation != id.generation || node.level == FREE || node.level == CANCELLED) return false;
+
+        if (node.level == READY) {
+            // 이미 만기되어 ready 목록에서 대기 중 - 그대로 두고 꺼낼 때 건너뜀
+            node.level = CANCELLED;
+        } else {
+            unlink(id.index);
+            freeNode(id.index);
+        }
+        --pending_;
+        return true;
+    }
+
+    /**
+     * @brief 만기된 item 이 생길 때까지 대기
+     * stop() 이후에는 기본 생성된 T 반환 (SafeQueue::pop 과 동일)
+     */
+    T pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            if (auto item = takeReadyLocked()) return std::move(*item);
+            if (!running_) return {};
+            waitNextLocked(lock, Clock::time_point::max());
+        }
+    }
+
+    std::optional<T> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return takeReadyLocked();
+    }
+
+    template <typename Rep, typename Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+        const auto deadline = Clock::now() + timeout;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            if (auto item = takeReadyLocked()) return item;
+            if (!running_ || Clock::now() >= deadline) return std::nullopt;
+            waitNextLocked(lock, deadline);
+        }
+    }
+
+    void stop() {
+        { std::lock_guard<std::mutex> lock(mutex_); running_ = false; }
+        cond_.notify_all();
+    }
+
+    // 만기 전이거나 아직 꺼내지 않은 타이머 수
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pending_;
+    }
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+    static constexpr uint8_t FREE = 0xFF;
+    static constexpr uint8_t READY = 0xFE;
+    static constexpr uint8_t CANCELLED = 0xFD;
+    static constexpr uint64_t MAX_SPAN = (uint64_t{1} << (SLOT_BITS * LEVELS)) - 1;
+
+    struct Node {
+        std::optional<T> value;
+        uint64_t expire = 0;
+        uint32_t prev = NIL;
+        uint32_t next = NIL;
+        uint32_t generation = 0;
+        uint8_t level = FREE;
+        uint8_t slot = 0;
+    };
+
+    uint32_t allocNode() {
+        if (free_head_ != NIL) {
+            const uint32_t index = free_head_;
+            free_head_ = nodes_[index].next;
+            return index;
+        }
+        nodes_.emplace_back();
+        return static_cast<uint32_t>(nodes_.size() - 1);
+    }
+
+    void freeNode(uint32_t index) {
+        Node& node = nodes_[index];
+        node.value.reset();
+        node.level = FREE;
+        ++node.generation;
+        node.prev = NIL;
+        node.next = free_head_;
+        free_head_ = index;
+    }
+
+    // expire 에 맞는 단계 / 슬롯에 연결 (이미 만기면 ready 로)
+    void place(uint32_t index) {
+        Node& node = nodes_[index];
+        if (node.expire <= current_tick_) {
+            node.level = READY;
+            ready_.push_back(index);
+            return;
+        }
+
+        uint64_t expire = node.expire;
+        uint64_t delta = expire - current_tick_;
+        if (delta > MAX_SPAN) {
+            expire = current_tick_ + MAX_SPAN; // 최상위 단계 끝에 두고 cascade 시 재배치
+            delta = MAX_SPAN;
+        }
+
+        int level = 0;
+        while (level < LEVELS - 1 && delta >= (uint64_t{1} << (SLOT_BITS * (level + 1)))) ++level;
+        const uint32_t slot = static_cast<uint32_t>((expire >> (SLOT_BITS * level)) & (SLOTS - 1));
+
+        node.level = static_cast<uint8_t>(level);
+        node.slot = static_cast<uint8_t>(slot);
+        node.prev = NIL;
+        node.next = heads_[level][slot];
+        if (node.next != NIL) nodes_[node.next].prev = index;
+        heads_[level][slot] = index;
+        occupied_[level] |= uint64_t{1} << slot;
+        ++wheel_count_;
+    }
+
+    void unlink(uint32_t index) {
+        Node& node = nodes_[index];
+        if (node.prev != NIL) nodes_[node.prev].next = node.next;
+        else heads_[node.level][node.slot] = node.next;
+        if (node.next != NIL) nodes_[node.next].prev = node.prev;
+        if (heads_[node.level][node.slot] == NIL) occupied_[node.level] &= ~(uint64_t{1} << node.slot);
+        --wheel_count_;
+    }
+
+    // 슬롯의 node 를 모두 떼어내 다시 배치 (상위 단계 -> 하위 단계, 또는 level 0 -> ready)
+    void flushSlot(int level, uint32_t slot) {
+        uint32_t index = heads_[level][slot];
+        heads_[level][slot] = NIL;
+        occupied_[level] &= ~(uint64_t{1} << slot);
+        while (index != NIL) {
+            const uint32_t next = nodes_[index].next;
+            --wheel_count_;
+            place(index);
+            index = next;
+        }
+    }
+
+    void advanceTo(uint64_t now_tick) {
+        if (wheel_count_ == 0) {
+            if (now_tick > current_tick_) current_tick_ = now_tick;
+            return;
+        }
+        while (current_tick_ < now_tick) {
+            ++current_tick_;
+            for (int level = 1; level < LEVELS; ++level) {
+                const int shift = SLOT_BITS * level;
+                if ((current_tick_ & ((uint64_t{1} << shift) - 1)) != 0) break;
+                flushSlot(level, static_cast<uint32_t>((current_tick_ >> shift) & (SLOTS - 1)));
+            }
+            flushSlot(0, static_cast<uint32_t>(current_tick_ & (SLOTS - 1)));
+            if (wheel_count_ == 0) {
+                current_tick_ = now_tick;
+                break;
+            }
+        }
+    }
+
+    uint64_t nowTick() const {
+        return static_cast<uint64_t>((Clock::now() - start_) / tick_);
+    }
+
+    std::optional<T> takeReadyLocked() {
+        advanceTo(nowTick());
+        while (!ready_.empty()) {
+            const uint32_t index = ready_.front();
+            ready_.pop_front();
+            Node& node = nodes_[index];
+            if (node.level == CANCELLED) {
+                freeNode(index);
+                continue;
+            }
+            std::optional<T> item(std::move(node.value));
+            freeNode(index);
+            --pending_;
+            return item;
+        }
+        return std::nullopt;
+    }
+
+    // 가장 먼저 처리해야 할 슬롯이 돌아오는 tick (상위 단계는 cascade 시점)
+    uint64_t nextEventTick() const {
+        uint64_t best = UINT64_MAX;
+        for (int level = 0; level < LEVELS; ++level) {
+            if (occupied_[level] == 0) continue;
+            const int shift = SLOT_BITS * level;
+            const uint64_t cur_slot = (current_tick_ >> shift) & (SLOTS - 1);
+            // cur_slot 다음 슬롯부터 회전 검색
+            const uint32_t rot = static_cast<uint32_t>((cur_slot + 1) & (SLOTS - 1));
+            const uint64_t rotated = (occupied_[level] >> rot) | (rot ? occupied_[level] << (SLOTS - rot) : 0);
+            const uint64_t distance = static_cast<uint64_t>(__builtin_ctzll(rotated)) + 1;
+            const uint64_t base = (current_tick_ >> shift) << shift;
+            const uint64_t tick = base + (distance << shift);
+            if (tick < best) best = tick;
+        }
+        return best;
+    }
+
+    void waitNextLocked(std::unique_lock<std::mutex>& lock, Clock::time_point deadline) {
+        const uint64_t next = nextEventTick();
+        if (next != UINT64_MAX) {
+            const auto due = start_ + tick_ * static_cast<Clock::rep>(next);
+            if (due < deadline) deadline = due;
+        }
+        if (deadline == Clock::time_point::max()) cond_.wait(lock);
+        else cond_.wait_until(lock, deadline);
+    }
+
+    const Clock::duration tick_;
+    const Clock::time_point start_;
+    uint64_t current_tick_ = 0;
+
+    std::vector<Node> nodes_;      // slab (index 로 참조하므로 재할당되어도 안전)
+    uint32_t free_head_ = NIL;
+    uint32_t heads_[LEVELS][SLOTS];
+    uint64_t occupied_[LEVELS] = {};
+    std::size_t wheel_count_ = 0;  // wheel 에 걸려있는 node 수
+    std::size_t pending_ = 0;      // wheel + ready (취소 제외)
+    RingBuffer<uint32_t> ready_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    bool running_ = true;
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,150 @@
+#pragma once
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief eventfd 를 노출하여 epoll 루프에서 다중화할 수 있는 스레드 안전 큐
+ *
+ * fd() 는 큐에 item 이 있거나 stop() 된 동안 readable 상태를 유지한다 (level-triggered).
+ * eventfd write/read 는 비어있음 <-> 비어있지 않음 전환 시에만 발생한다.
+ *
+ * @note
+ * 1. fd() 는 EFD_NONBLOCK 이며 큐가 소유한다. 직접 read/close 하지 말 것.
+ * 2. eventfd 생성 실패 시 생성자에서 std::system_error 를 던진다.
+ *
+ * 사용 예시:
+ * ```cpp
+ * EventQueue<Msg> queue;
+ * epoll_event ev{EPOLLIN, {.ptr = &queue}};
+ * epoll_ctl(epfd, EPOLL_CTL_ADD, queue.fd(), &ev);
+ * ...
+ * // EPOLLIN 발생 시
+ * std::vector<Msg> batch;
+ * queue.drain(batch);
+ * ```
+ */
+template <typename T>
+class EventQueue {
+public:
+    EventQueue() : event_fd_(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+        if (event_fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "[EventQueue] eventfd");
+        }
+    }
+
+    ~EventQueue() {
+        ::close(event_fd_);
+    }
+
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    int fd() const { return event_fd_; }
+
+    /**
+     * @return false: stop() 이후라 삽입되지 않음
+     */
+    bool push(T item) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return false;
+        queue_.push_back(std::move(item));
+        if (queue_.size() == 1) signal();
+        return true;
+    }
+
+    std::optional<T> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) return std::nullopt;
+        T item = std::move(queue_.front());
+        queue_.pop_front();
+        if (queue_.empty() && running_) clear();
+        return item;
+    }
+
+    /**
+     * @brief 대기 없이 최대 max 개를 out 뒤에 이동 (epoll 이벤트 한 번에 일괄 처리용)
+     * @return 이동한 item 수
+     */
+    std::size_t drain(std::vector<T>& out, std::size_t max = SIZE_MAX) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t count = 0;
+        while (!queue_.empty() && count < max) {
+            out.push_back(std::move(queue_.front()));
+            queue_.pop_front();
+            ++count;
+        }
+        if (count > 0 && queue_.empty() && running_) clear();
+        return count;
+    }
+
+    /**
+     * @brief 전용 스레드에서 사용할 때의 blocking pop (SafeQueue::pop 과 동일한 형태)
+     */
+    T pop() {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!queue_.empty()) {
+                    T item = std::move(queue_.front());
+                    queue_.pop_front();
+                    if (queue_.empty() && running_) clear();
+                    return item;
+                }
+                if (!running_) return {};
+            }
+            struct pollfd pfd{event_fd_, POLLIN, 0};
+            ::poll(&pfd, 1, -1);
+        }
+    }
+
+    /**
+     * @brief 이후 push 거부, fd 는 계속 readable 상태가 되어 epoll 루프가 종료를 감지할 수 있음
+     */
+    void stop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        running_ = false;
+        if (queue_.empty()) signal();
+    }
+
+    bool is_stopped() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !running_;
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
+private:
+    void signal() {
+        uint64_t one = 1;
+        while (::write(event_fd_, &one, sizeof(one)) < 0 && errno == EINTR) {}
+    }
+
+    void clear() {
+        uint64_t value;
+        while (::read(event_fd_, &value, sizeof(value)) < 0 && errno == EINTR) {}
+    }
+
+    int event_fd_;
+    std::deque<T> queue_;
+    mutable std::mutex mutex_;
+    bool running_ = true;
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
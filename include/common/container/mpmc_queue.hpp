@@ -0,0 +1,194 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "common/sync/cache_line.hpp"
+#include "common/sync/event_count.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief 슬롯별 sequence 번호 기반 bounded lock-free multi-producer / multi-consumer 큐
+ *
+ * @tparam T 저장할 타입
+ *
+ * @note
+ * 1. try_push / try_pop 은 lock 없이 CAS 만 사용한다.
+ * 2. push / pop 은 잠깐 spin 후 futex 로 대기하며, 대기자가 없으면 syscall 을 하지 않는다.
+ * 3. SafeQueue<T> 대체용으로 push / pop / stop 형태를 동일하게 유지한다.
+ *    (stop() 이후 비어있으면 pop() 은 기본 생성된 T 반환)
+ *
+ * 사용 예시:
+ * ```cpp
+ * MpmcQueue<Job> jobs(1024);
+ * jobs.push(job);            // 여러 producer 스레드
+ * Job next = jobs.pop();     // 여러 worker 스레드
+ * ```
+ */
+template <typename T>
+class MpmcQueue {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    /**
+     * @param capacity 최대 item 수 (2의 거듭제곱으로 올림)
+     */
+    explicit MpmcQueue(std::size_t capacity = DEFAULT_CAPACITY)
+        : capacity_(roundUpPow2(capacity < 2 ? 2 : capacity))
+        , mask_(capacity_ - 1)
+        , slots_(new Slot[capacity_]) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpmcQueue() {
+        T item;
+        while (try_pop(item)) {}
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    bool try_push(T&& item) { return tryEmplace(std::move(item)); }
+    bool try_push(const T& item) { return tryEmplace(item); }
+
+    bool try_pop(T& out) {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            const std::size_t seq = slot->seq.load(std::memory_order_acquire);
+            const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false; // empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* value = slot->value();
+        out = std::move(*value);
+        value->~T();
+        slot->seq.store(pos + mask_ + 1, std::memory_order_release);
+        not_full_.notifyOne();
+        return true;
+    }
+
+    /**
+     * @brief 공간이 생길 때까지 대기 후 삽입
+     * @return false: stop() 으로 삽입되지 않음
+     */
+    bool push(T item) {
+        for (int spin = 0; ; ++spin) {
+            if (!running_.load(std::memory_order_acquire)) return false;
+            if (tryEmplace(std::move(item))) return true;
+            if (spin < SPIN_LIMIT) continue;
+
+            uint32_t key = not_full_.prepareWait();
+            if (size() < capacity_ || !running_.load(std::memory_order_acquire)) {
+                not_full_.cancelWait();
+                continue;
+            }
+            not_full_.wait(key);
+        }
+    }
+
+    /**
+     * @brief item 이 들어올 때까지 대기 (idle consumer 는 futex 로 sleep)
+     */
+    T pop() {
+        T item;
+        for (int spin = 0; ; ++spin) {
+            if (try_pop(item)) return item;
+            if (!running_.load(std::memory_order_acquire)) {
+                return try_pop(item) ? std::move(item) : T{};
+            }
+            if (spin < SPIN_LIMIT) continue;
+
+            uint32_t key = not_empty_.prepareWait();
+            if (size() != 0 || !running_.load(std::memory_order_acquire)) {
+                not_empty_.cancelWait();
+                continue;
+            }
+            not_empty_.wait(key);
+        }
+    }
+
+    void stop() {
+        running_.store(false, std::memory_order_release);
+        not_empty_.notifyAll();
+        not_full_.notifyAll();
+    }
+
+    // 대략적인 크기 (다른 스레드가 동시에 변경 중일 수 있음)
+    std::size_t size() const {
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    static constexpr int SPIN_LIMIT = 64;
+
+    struct alignas(SYNC::CACHE_LINE_SIZE) Slot {
+        std::atomic<std::size_t> seq;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T* value() { return std::launder(reinterpret_cast<T*>(&storage)); }
+    };
+
+    static std::size_t roundUpPow2(std::size_t v) {
+        std::size_t p = 1;
+        while (p < v) p <<= 1;
+        return p;
+    }
+
+    // 실패 시 item 을 건드리지 않는다 (push() 재시도용)
+    template <typename U>
+    bool tryEmplace(U&& item) {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            const std::size_t seq = slot->seq.load(std::memory_order_acquire);
+            const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (&slot->storage) T(std::forward<U>(item));
+        slot->seq.store(pos + 1, std::memory_order_release);
+        not_empty_.notifyOne();
+        return true;
+    }
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<std::size_t> tail_{0}; // producer 위치
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<std::size_t> head_{0}; // consumer 위치
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<bool> running_{true};
+    SYNC::EventCount not_empty_;
+    SYNC::EventCount not_full_;
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
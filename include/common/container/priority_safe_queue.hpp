@@ -0,0 +1,138 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "common/container/ring_buffer.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief 고정 개수 우선순위 단계를 가진 스레드 안전 큐
+ *
+ * 단계마다 FIFO 를 두고, 비어있지 않은 단계를 bitmap 으로 관리하여 push / pop 이 O(1) 이다.
+ * (하드웨어 장애, RTK fix 손실, 안전 사운드가 대량 telemetry 뒤에 밀리지 않도록)
+ *
+ * @tparam T      저장할 타입
+ * @tparam Levels 우선순위 단계 수 (최대 32). 0 이 가장 높음
+ *
+ * @note aging_interval > 0 이면 pop 을 aging_interval 번 할 때마다 각 하위 단계의
+ *       맨 앞 item 을 한 단계씩 올려 하위 단계 기아(starvation)를 방지한다.
+ *
+ * 사용 예시:
+ * ```cpp
+ * PrioritySafeQueue<Event, 4> events(64);       // 64번 pop 마다 aging
+ * events.push(hw_failure, 0);
+ * events.push(telemetry, 3);
+ * Event next = events.pop();                    // hw_failure 먼저
+ * ```
+ */
+template <typename T, std::size_t Levels = 8>
+class PrioritySafeQueue {
+    static_assert(Levels >= 1 && Levels <= 32, "PrioritySafeQueue supports 1..32 levels");
+
+public:
+    static constexpr std::size_t LEVELS = Levels;
+
+    explicit PrioritySafeQueue(uint32_t aging_interval = 0) : aging_interval_(aging_interval) {}
+
+    /**
+     * @param level 0 (최우선) ~ Levels-1. 범위를 넘으면 가장 낮은 단계로 취급
+     */
+    void push(T item, std::size_t level) {
+        if (level >= Levels) level = Levels - 1;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            levels_[level].push_back(std::move(item));
+            bitmap_ |= 1u << level;
+            ++size_;
+        }
+        cond_.notify_one();
+    }
+
+    T pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return bitmap_ != 0 || !running_; });
+        if (bitmap_ == 0) return {};
+        return takeLocked();
+    }
+
+    std::optional<T> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (bitmap_ == 0) return std::nullopt;
+        return takeLocked();
+    }
+
+    template <typename Rep, typename Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cond_.wait_for(lock, timeout, [this] { return bitmap_ != 0 || !running_; })) {
+            return std::nullopt;
+        }
+        if (bitmap_ == 0) return std::nullopt;
+        return takeLocked();
+    }
+
+    void stop() {
+        { std::lock_guard<std::mutex> lock(mutex_); running_ = false; }
+        cond_.notify_all();
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return size_;
+    }
+
+    std::size_t size(std::size_t level) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return level < Levels ? levels_[level].size() : 0;
+    }
+
+private:
+    T takeLocked() {
+        if (aging_interval_ != 0 && ++pops_since_aging_ >= aging_interval_) {
+            pops_since_aging_ = 0;
+            age();
+        }
+
+        const std::size_t level = static_cast<std::size_t>(__builtin_ctz(bitmap_));
+        RingBuffer<T>& queue = levels_[level];
+        T item = std::move(queue.front());
+        queue.pop_front();
+        if (queue.empty()) bitmap_ &= ~(1u << level);
+        --size_;
+        return item;
+    }
+
+    // 각 하위 단계의 가장 오래된 item 을 한 단계 위로 (상위부터 처리하여 한 번에 한 단계만 이동)
+    void age() {
+        for (std::size_t level = 1; level < Levels; ++level) {
+            RingBuffer<T>& from = levels_[level];
+            if (from.empty()) continue;
+            levels_[level - 1].push_back(std::move(from.front()));
+            from.pop_front();
+            bitmap_ |= 1u << (level - 1);
+            if (from.empty()) bitmap_ &= ~(1u << level);
+        }
+    }
+
+    std::array<RingBuffer<T>, Levels> levels_;
+    uint32_t bitmap_ = 0; // bit i: levels_[i] 비어있지 않음
+    std::size_t size_ = 0;
+
+    const uint32_t aging_interval_;
+    uint32_t pops_since_aging_ = 0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    bool running_ = true;
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
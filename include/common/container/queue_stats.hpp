@@ -0,0 +1,118 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * SafeQueue 계측 정책 (Stats 템플릿 인자)
+ *
+ * NoQueueStats : 기본값. Stamp 가 빈 타입이고 hook 이 모두 비어 있어 오버헤드 없음
+ * QueueStats   : 현재 깊이, high-water mark, push/pop 누적 수, 큐 체류 시간 histogram
+ *
+ * 모든 값은 atomic 이므로 다른 스레드가 queue mutex 없이 읽을 수 있다.
+ *
+ * 사용 예시:
+ * ```cpp
+ * SafeQueue<Msg, SYNC::BlockingWait, QueueStats> mqtt_queue;
+ * auto s = mqtt_queue.stats().snapshot();
+ * log("depth=%zu hwm=%zu", s.depth, s.high_water);
+ * ```
+ */
+struct NoQueueStats {
+    struct Stamp {};
+
+    Stamp onEnqueue(std::size_t /*depth*/) { return {}; }
+    void onDequeue(const Stamp& /*stamp*/, std::size_t /*depth*/) {}
+    void onDiscard(std::size_t /*depth*/) {}
+};
+
+class QueueStats {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * bucket 0   : 1us 미만
+     * bucket i   : [2^(i-1), 2^i) us
+     * 마지막 bucket : 그 이상 전부 (약 4초 이상)
+     */
+    static constexpr std::size_t LATENCY_BUCKETS = 24;
+
+    struct Stamp {
+        Clock::time_point enqueued;
+    };
+
+    struct Snapshot {
+        std::size_t depth;
+        std::size_t high_water;
+        uint64_t pushes;
+        uint64_t pops;
+        std::array<uint64_t, LATENCY_BUCKETS> latency_us_log2;
+    };
+
+    Stamp onEnqueue(std::size_t depth) {
+        pushes_.fetch_add(1, std::memory_order_relaxed);
+        depth_.store(depth, std::memory_order_relaxed);
+
+        std::size_t hwm = high_water_.load(std::memory_order_relaxed);
+        while (depth > hwm &&
+               !high_water_.compare_exchange_weak(hwm, depth, std::memory_order_relaxed)) {}
+
+        return Stamp{Clock::now()};
+    }
+
+    void onDequeue(const Stamp& stamp, std::size_t depth) {
+        pops_.fetch_add(1, std::memory_order_relaxed);
+        depth_.store(depth, std::memory_order_relaxed);
+
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - stamp.enqueued).count();
+        latency_[bucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void onDiscard(std::size_t depth) {
+        depth_.store(depth, std::memory_order_relaxed);
+    }
+
+    std::size_t depth() const { return depth_.load(std::memory_order_relaxed); }
+    std::size_t high_water() const { return high_water_.load(std::memory_order_relaxed); }
+    uint64_t pushes() const { return pushes_.load(std::memory_order_relaxed); }
+    uint64_t pops() const { return pops_.load(std::memory_order_relaxed); }
+
+    Snapshot snapshot() const {
+        Snapshot s;
+        s.depth = depth();
+        s.high_water = high_water();
+        s.pushes = pushes();
+        s.pops = pops();
+        for (std::size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+            s.latency_us_log2[i] = latency_[i].load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    // high-water mark 및 histogram 초기화 (주기적 리포트용)
+    void resetPeaks() {
+        high_water_.store(depth(), std::memory_order_relaxed);
+        for (auto& bucket : latency_) bucket.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static std::size_t bucketOf(int64_t us) {
+        if (us <= 0) return 0;
+        std::size_t bucket = 64 - static_cast<std::size_t>(__builtin_clzll(static_cast<uint64_t>(us)));
+        return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+    }
+
+    std::atomic<std::size_t> depth_{0};
+    std::atomic<std::size_t> high_water_{0};
+    std::atomic<uint64_t> pushes_{0};
+    std::atomic<uint64_t> pops_{0};
+    std::array<std::atomic<uint64_t>, LATENCY_BUCKETS> latency_{};
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,155 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <new>
+#include <utility>
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief 연속 메모리 기반 가변 용량 링 버퍼 (std::queue 용 컨테이너)
+ *
+ * 가득 찼을 때만 2배로 늘어나고 줄어들지 않는다.
+ * warm-up 이후 push_back / pop_front 는 heap 할당을 하지 않는다.
+ * (std::deque 는 steady-state 에서도 chunk 를 계속 할당/해제하여 glibc heap 을 단편화시킴)
+ */
+template <typename T>
+class RingBuffer {
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+
+    static constexpr size_type INITIAL_CAPACITY = 16;
+
+    RingBuffer() = default;
+
+    ~RingBuffer() {
+        clear();
+        ::operator delete(buffer_, std::align_val_t(alignof(T)));
+    }
+
+    RingBuffer(RingBuffer&& other) noexcept
+        : buffer_(other.buffer_), capacity_(other.capacity_), head_(other.head_), size_(other.size_) {
+        other.buffer_ = nullptr;
+        other.capacity_ = other.head_ = other.size_ = 0;
+    }
+
+    RingBuffer& operator=(RingBuffer&& other) noexcept {
+        if (this != &other) {
+            clear();
+            ::operator delete(buffer_, std::align_val_t(alignof(T)));
+            buffer_ = other.buffer_;
+            capacity_ = other.capacity_;
+            head_ = other.head_;
+            size_ = other.size_;
+            other.buffer_ = nullptr;
+            other.capacity_ = other.head_ = other.size_ = 0;
+        }
+        return *this;
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type capacity() const { return capacity_; }
+
+    reference front() { return *slot(0); }
+    const_reference front() const { return *slot(0); }
+    reference back() { return *slot(size_ - 1); }
+    const_reference back() const { return *slot(size_ - 1); }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ == capacity_) grow(capacity_ ? capacity_ * 2 : INITIAL_CAPACITY);
+        T* p = new (rawSlot(size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+
+    void pop_front() {
+        slot(0)->~T();
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --size_;
+    }
+
+    void clear() {
+        while (size_ > 0) pop_front();
+        head_ = 0;
+    }
+
+    /**
+     * @brief 최소 n 개를 재할당 없이 담을 수 있도록 미리 확보 (2의 거듭제곱으로 올림)
+     */
+    void reserve(size_type n) {
+        if (n <= capacity_) return;
+        size_type cap = capacity_ ? capacity_ : INITIAL_CAPACITY;
+        while (cap < n) cap *= 2;
+        grow(cap);
+    }
+
+private:
+    void* rawSlot(size_type i) const {
+        return buffer_ + ((head_ + i) & (capacity_ - 1)) * sizeof(T);
+    }
+    T* slot(size_type i) const {
+        return std::launder(reinterpret_cast<T*>(rawSlot(i)));
+    }
+
+    // 모든 원소를 새 버퍼로 옮긴 뒤에만 원본을 파괴한다.
+    // (복사 생성자가 도중에 throw 하면 새 버퍼만 되돌리고 기존 상태는 그대로 유지)
+    void grow(size_type new_capacity) {
+        auto* fresh = static_cast<unsigned char*>(
+            ::operator new(new_capacity * sizeof(T), std::align_val_t(alignof(T))));
+        size_type built = 0;
+        try {
+            for (; built < size_; ++built) {
+                new (fresh + built * sizeof(T)) T(std::move_if_noexcept(*slot(built)));
+            }
+        } catch (...) {
+            for (size_type i = 0; i < built; ++i) {
+                std::launder(reinterpret_cast<T*>(fresh + i * sizeof(T)))->~T();
+            }
+            ::operator delete(fresh, std::align_val_t(alignof(T)));
+            throw;
+        }
+        for (size_type i = 0; i < size_; ++i) {
+            slot(i)->~T();
+        }
+        ::operator delete(buffer_, std::align_val_t(alignof(T)));
+        buffer_ = fresh;
+        capacity_ = new_capacity;
+        head_ = 0;
+    }
+
+    unsigned char* buffer_ = nullptr;
+    size_type capacity_ = 0; // 0 또는 2의 거듭제곱
+    size_type head_ = 0;
+    size_type size_ = 0;
+};
+
+/**
+ * SafeQueue 저장소 정책 (Storage 템플릿 인자)
+ *
+ * DequeStorage : 기본값. std::deque (기존 동작)
+ * RingStorage  : RingBuffer. warm-up 이후 push/pop 에서 heap 할당 없음
+ */
+struct DequeStorage {
+    template <typename U>
+    using type = std::deque<U>;
+};
+
+struct RingStorage {
+    template <typename U>
+    using type = RingBuffer<U>;
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
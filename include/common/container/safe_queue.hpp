@@ -1,41 +1,289 @@
-
 #pragma once
 #include <queue>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/container/queue_stats.hpp"
+#include "common/container/ring_buffer.hpp"
+#include "common/sync/wait_strategy.hpp"
 
 namespace GR {
 namespace LIBCOMMON {
-template <typename T>
+
+/**
+ * @brief 용량 제한 큐가 가득 찼을 때의 처리 정책
+ */
+enum class OverflowPolicy : uint8_t {
+    BLOCK       = 0, // 공간이 생길 때까지 producer 대기
+    DROP_NEWEST = 1, // 새로 들어온 item 폐기
+    DROP_OLDEST = 2, // 가장 오래된 item 폐기 후 삽입
+    REJECT      = 3  // 삽입하지 않고 REJECTED 반환
+};
+
+/**
+ * @brief push() 결과
+ */
+enum class PushResult : uint8_t {
+    OK             = 0, // 정상 삽입
+    DROPPED_OLDEST = 1, // 삽입됨, 대신 가장 오래된 item 폐기
+    DROPPED_NEWEST = 2, // 삽입되지 않음 (새 item 폐기)
+    REJECTED       = 3, // 삽입되지 않음 (REJECT 정책)
+    STOPPED        = 4  // stop() 이후라 삽입되지 않음
+};
+
+/**
+ * @brief stop() 방식
+ */
+enum class StopMode : uint8_t {
+    IMMEDIATE = 0, // 기존 동작. consumer 를 즉시 깨우고 반환 (남은 item 은 큐에 남음)
+    DRAIN     = 1, // consumer 가 남은 item 을 모두 꺼낼 때까지 stop() 이 대기
+    HAND_BACK = 2  // 남은 item 을 모두 꺼내 stop() 호출자에게 반환
+};
+
+/**
+ * @brief mutex 기반 스레드 안전 FIFO 큐
+ *
+ * @tparam T            저장할 타입
+ * @tparam WaitStrategy consumer 대기 방식 (common/sync/wait_strategy.hpp)
+ *                      - SYNC::BlockingWait (기본, condition_variable)
+ *                      - SYNC::SpinThenFutexWait<N> : 지연 민감 consumer (사운드 큐 트리거 등)
+ *                      - SYNC::BusySpinWait         : 전용 core 에 고정된 consumer
+ * @tparam Stats        계측 정책 (common/container/queue_stats.hpp)
+ *                      - NoQueueStats (기본, 오버헤드 없음) / QueueStats
+ * @tparam Storage      저장소 정책 (common/container/ring_buffer.hpp)
+ *                      - DequeStorage (기본) / RingStorage (warm-up 이후 heap 할당 없음)
+ */
+template <typename T,
+          typename WaitStrategy = SYNC::BlockingWait,
+          typename Stats = NoQueueStats,
+          typename Storage = DequeStorage>
 class SafeQueue {
 public:
-    void push(T item) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        queue_.push(std::move(item));
-        cond_.notify_one();
+    static constexpr std::size_t UNBOUNDED = 0;
+
+    SafeQueue() = default;
+
+    /**
+     * @brief 용량 제한 큐 생성
+     * @param capacity 최대 item 수 (UNBOUNDED 이면 제한 없음)
+     * @param policy   가득 찼을 때의 처리 정책 (큐마다 생성 시 고정)
+     */
+    explicit SafeQueue(std::size_t capacity, OverflowPolicy policy = OverflowPolicy::BLOCK)
+        : capacity_(capacity), policy_(policy) {}
+
+    PushResult push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        PushResult result = pushLocked(lock, std::move(item));
+        if (isEnqueued(result)) cond_.notify_one();
+        return result;
+    }
+
+    /**
+     * @brief [first, last) 범위를 lock 한 번, notify 한 번으로 삽입
+     *
+     * 범위의 item 은 move 되며, 용량 정책은 item 마다 push() 와 동일하게 적용된다.
+     * @return 실제로 큐에 들어간 item 수
+     */
+    template <typename InputIt>
+    std::size_t push_bulk(InputIt first, InputIt last) {
+        std::size_t pushed = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            for (; first != last; ++first) {
+                if (policy_ == OverflowPolicy::BLOCK && isFull() && pushed > 0) {
+                    // 대기 전에 consumer 를 깨워 공간 확보
+                    cond_.notify_all();
+                }
+                PushResult result = pushLocked(lock, T(std::move(*first)));
+                if (result == PushResult::STOPPED) break;
+                if (isEnqueued(result)) ++pushed;
+            }
+        }
+        if (pushed == 1) cond_.notify_one();
+        else if (pushed > 1) cond_.notify_all();
+        return pushed;
     }
 
     T pop() {
         std::unique_lock<std::mutex> lock(mutex_);
         cond_.wait(lock, [this] { return !queue_.empty() || !running_; });
         if (queue_.empty()) return {};
-        T item = std::move(queue_.front());
-        queue_.pop();
-        return item;
+        return takeFrontLocked();
+    }
+
+    /**
+     * @brief 대기 없이 꺼내기
+     * @return 비어있으면 std::nullopt
+     */
+    std::optional<T> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) return std::nullopt;
+        return takeFrontLocked();
+    }
+
+    /**
+     * @brief 최대 timeout 동안 대기 후 꺼내기
+     * @return timeout 또는 stop() 으로 비어있으면 std::nullopt
+     */
+    template <typename Rep, typename Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+        return pop_until(std::chrono::steady_clock::now() + timeout);
+    }
+
+    template <typename Clock, typename Duration>
+    std::optional<T> pop_until(const std::chrono::time_point<Clock, Duration>& deadline) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cond_.wait_until(lock, deadline, [this] { return !queue_.empty() || !running_; })) {
+            return std::nullopt;
+        }
+        if (queue_.empty()) return std::nullopt;
+        return takeFrontLocked();
+    }
+
+    /**
+     * @brief item 이 들어올 때까지 대기 후 최대 max 개를 lock 한 번에 out 뒤에 이동
+     * @return 이동한 item 수 (stop() 이후 비어있으면 0)
+     */
+    std::size_t drain(std::vector<T>& out, std::size_t max = SIZE_MAX) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return !queue_.empty() || !running_; });
+
+        std::size_t count = 0;
+        while (!queue_.empty() && count < max) {
+            out.push_back(takeFrontLocked(false));
+            ++count;
+        }
+        if (capacity_ != UNBOUNDED && count > 0) not_full_.notify_all();
+        return count;
     }
 
     void stop() {
-        { std::lock_guard<std::mutex> lock(mutex_); running_ = false; }
-        cond_.notify_all();
+        stop(StopMode::IMMEDIATE);
+    }
+
+    /**
+     * @brief 큐 종료. 이후 push 는 STOPPED 를 반환한다.
+     *
+     * DRAIN 은 consumer 가 큐를 모두 비웠을 때 반환된다. 살아있는 consumer 가 있어야 하며
+     * consumer 스레드에서 호출하면 안 된다. (마지막 item 의 처리 완료는 consumer join 으로 확인)
+     * @return HAND_BACK 일 때 남아있던 item (FIFO 순서), 그 외에는 빈 vector
+     */
+    std::vector<T> stop(StopMode mode) {
+        std::vector<T> leftovers;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            running_ = false;
+            if (mode == StopMode::HAND_BACK) {
+                leftovers.reserve(queue_.size());
+                while (!queue_.empty()) leftovers.push_back(takeFrontLocked(false));
+            }
+            cond_.notify_all();
+            not_full_.notify_all();
+            if (mode == StopMode::DRAIN) {
+                drained_.wait(lock, [this] { return queue_.empty(); });
+            }
+        }
+        return leftovers;
+    }
+
+    bool is_stopped() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !running_;
     }
 
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
+    std::size_t capacity() const { return capacity_; }
+    OverflowPolicy policy() const { return policy_; }
+
+    // DROP_NEWEST / DROP_OLDEST 정책으로 폐기된 item 수 (lock 없이 조회 가능)
+    uint64_t dropped_count() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // REJECT 정책으로 거부된 push 횟수
+    uint64_t rejected_count() const { return rejected_.load(std::memory_order_relaxed); }
+
+    // Stats = QueueStats 일 때 깊이 / high-water / 체류 시간 조회 (lock 없이 호출 가능)
+    const Stats& stats() const { return stats_; }
+
 private:
-    std::queue<T> queue_;
-    std::mutex mutex_;
-    std::condition_variable cond_;
+    PushResult pushLocked(std::unique_lock<std::mutex>& lock, T&& item) {
+        PushResult result = PushResult::OK;
+        if (!running_) return PushResult::STOPPED;
+
+        if (isFull()) {
+            switch (policy_) {
+            case OverflowPolicy::BLOCK:
+                not_full_.wait(lock, [this] { return !isFull() || !running_; });
+                if (!running_) return PushResult::STOPPED;
+                break;
+            case OverflowPolicy::DROP_NEWEST:
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return PushResult::DROPPED_NEWEST;
+            case OverflowPolicy::DROP_OLDEST:
+                queue_.pop();
+                stats_.onDiscard(queue_.size());
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                result = PushResult::DROPPED_OLDEST;
+                break;
+            case OverflowPolicy::REJECT:
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return PushResult::REJECTED;
+            }
+        }
+
+        typename Stats::Stamp stamp = stats_.onEnqueue(queue_.size() + 1);
+        queue_.emplace(std::move(item), stamp);
+        return result;
+    }
+
+    T takeFrontLocked(bool notify_producer = true) {
+        Node& node = queue_.front();
+        T item = std::move(node.value);
+        typename Stats::Stamp stamp = node;
+        queue_.pop();
+        stats_.onDequeue(stamp, queue_.size());
+        if (notify_producer && capacity_ != UNBOUNDED) not_full_.notify_one();
+        if (!running_ && queue_.empty()) drained_.notify_all();
+        return item;
+    }
+
+    static bool isEnqueued(PushResult result) {
+        return result == PushResult::OK || result == PushResult::DROPPED_OLDEST;
+    }
+
+    bool isFull() const {
+        return capacity_ != UNBOUNDED && queue_.size() >= capacity_;
+    }
+
+    // Stats::Stamp 이 빈 타입이면 EBO 로 Node 크기는 T 와 같다
+    struct Node : Stats::Stamp {
+        Node(T&& v, const typename Stats::Stamp& stamp) : Stats::Stamp(stamp), value(std::move(v)) {}
+        T value;
+    };
+
+    std::queue<Node, typename Storage::template type<Node>> queue_;
+    mutable std::mutex mutex_;
+    WaitStrategy cond_;
+    std::condition_variable not_full_;
+    std::condition_variable drained_;
     bool running_ = true;
+
+    std::size_t capacity_ = UNBOUNDED;
+    OverflowPolicy policy_ = OverflowPolicy::BLOCK;
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> rejected_{0};
+    Stats stats_;
 };
 
 
 } // namespace LIBCOMMON
-} // namespace GR
\ No newline at end of file
+} // namespace GR
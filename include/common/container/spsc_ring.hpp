@@ -0,0 +1,151 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "common/sync/cache_line.hpp"
+#include "common/sync/event_count.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief 고정 용량 lock-free single-producer / single-consumer 링 버퍼
+ *
+ * @tparam T        저장할 타입
+ * @tparam Capacity 슬롯 수 (2의 거듭제곱)
+ *
+ * @note
+ * 1. push 는 producer 스레드 하나, pop 은 consumer 스레드 하나에서만 호출해야 한다.
+ * 2. 대기 중인 상대가 없으면 push/pop 은 syscall 없이 atomic 연산만 수행한다.
+ * 3. SafeQueue 와 동일하게 stop() 이후 비어있으면 pop() 은 기본 생성된 T 를 반환한다.
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() = default;
+
+    ~SpscRing() {
+        for (std::size_t i = head_.load(); i != tail_.load(); ++i) {
+            slotAt(i)->~T();
+        }
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    bool try_push(T&& item) { return tryEmplace(std::move(item)); }
+    bool try_push(const T& item) { return tryEmplace(item); }
+
+    bool try_pop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) return false;
+        }
+        T* slot = slotAt(head);
+        out = std::move(*slot);
+        slot->~T();
+        head_.store(head + 1, std::memory_order_release);
+        not_full_.notifyOne();
+        return true;
+    }
+
+    /**
+     * @brief 공간이 생길 때까지 대기 후 삽입
+     * @return false: stop() 으로 삽입되지 않음
+     */
+    bool push(T item) {
+        for (int spin = 0; ; ++spin) {
+            if (!running_.load(std::memory_order_acquire)) return false;
+            if (try_push(std::move(item))) return true;
+            if (spin < SPIN_LIMIT) continue;
+
+            uint32_t key = not_full_.prepareWait();
+            if (!isFull() || !running_.load(std::memory_order_acquire)) {
+                not_full_.cancelWait();
+                continue;
+            }
+            not_full_.wait(key);
+        }
+    }
+
+    T pop() {
+        T item;
+        for (int spin = 0; ; ++spin) {
+            if (try_pop(item)) return item;
+            if (!running_.load(std::memory_order_acquire)) {
+                return try_pop(item) ? std::move(item) : T{};
+            }
+            if (spin < SPIN_LIMIT) continue;
+
+            uint32_t key = not_empty_.prepareWait();
+            if (!isEmpty() || !running_.load(std::memory_order_acquire)) {
+                not_empty_.cancelWait();
+                continue;
+            }
+            not_empty_.wait(key);
+        }
+    }
+
+    void stop() {
+        running_.store(false, std::memory_order_release);
+        not_empty_.notifyAll();
+        not_full_.notifyAll();
+    }
+
+    // 대략적인 크기 (다른 스레드가 동시에 변경 중일 수 있음)
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t capacity() { return Capacity; }
+
+private:
+    static constexpr int SPIN_LIMIT = 64;
+
+    // 실패 시 item 을 건드리지 않는다 (push() 재시도용)
+    template <typename U>
+    bool tryEmplace(U&& item) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ == Capacity) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ == Capacity) return false;
+        }
+        new (slotAt(tail)) T(std::forward<U>(item));
+        tail_.store(tail + 1, std::memory_order_release);
+        not_empty_.notifyOne();
+        return true;
+    }
+
+    T* slotAt(std::size_t index) {
+        return std::launder(reinterpret_cast<T*>(&slots_[index & (Capacity - 1)]));
+    }
+
+    bool isFull() const { return size() >= Capacity; }
+    bool isEmpty() const { return size() == 0; }
+
+    using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    // consumer 가 쓰는 영역
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<std::size_t> head_{0};
+    std::size_t tail_cache_ = 0;
+
+    // producer 가 쓰는 영역
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<std::size_t> tail_{0};
+    std::size_t head_cache_ = 0;
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<bool> running_{true};
+    SYNC::EventCount not_empty_;
+    SYNC::EventCount not_full_;
+
+    alignas(SYNC::CACHE_LINE_SIZE) Slot slots_[Capacity];
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "common/sync/atomic_words.hpp"
+#include "common/sync/wait_strategy.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+namespace IPC {
+
+/**
+ * @brief 단일 writer / 다수 reader 용 seqlock 래퍼 (프로세스 간 공유 가능)
+ *
+ * SharedState<T> 세그먼트 안의 멤버로 두고 사용한다.
+ * writer 는 lock 없이 기록하고, reader 는 기록 중이거나 도중에 값이 바뀌면 재시도하여
+ * 찢어지지 않은(torn-free) 복사본을 얻는다.
+ *
+ * @tparam T trivially copyable POD 구조체 (예: DeviceConfig)
+ *
+ * @note
+ * 1. writer 는 한 프로세스의 한 스레드여야 한다. (writer 가 여럿이면 별도 동기화 필요)
+ * 2. 데이터는 8바이트 단위 relaxed atomic 으로 복사하므로 mutex / syscall 이 없다.
+ *
+ * 사용 예시:
+ * ```cpp
+ * struct ConfigTable {
+ *     SeqLocked<DeviceConfig> gps;
+ * };
+ *
+ * // DCU (writer)
+ * shm->gps.update([](DeviceConfig& c) { c.setPort("/dev/ttyAMA0"); c.baudrate = 115200; });
+ *
+ * // Agent (reader)
+ * DeviceConfig cfg = shm->gps.load();
+ * ```
+ */
+template <typename T>
+class SeqLocked {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLocked requires trivially copyable T");
+
+public:
+    SeqLocked() : SeqLocked(T()) {}
+
+    explicit SeqLocked(const T& value) : data_(value) {}
+
+    SeqLocked(const SeqLocked&) = delete;
+    SeqLocked& operator=(const SeqLocked&) = delete;
+
+    /**
+     * @brief writer 전용. 값 전체를 교체
+     */
+    void store(const T& value) {
+        // 이전 writer 가 기록 도중 종료되어 홀수로 남아있어도 짝수 기준으로 이어감
+        const uint32_t seq = seq_.load(std::memory_order_relaxed) & ~1u;
+        seq_.store(seq + 1, std::memory_order_relaxed); // 홀수: 기록 중
+        std::atomic_thread_fence(std::memory_order_release);
+        data_.store(value);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief writer 전용. 현재 값을 읽어 fn 으로 수정 후 기록
+     */
+    template <typename F>
+    void update(F&& fn) {
+        T value = load();
+        fn(value);
+        store(value);
+    }
+
+    /**
+     * @brief 일관된 스냅샷을 얻을 때까지 재시도
+     */
+    T load() const {
+        T value;
+        while (!tryLoad(value)) {
+            SYNC::cpuRelax();
+        }
+        return value;
+    }
+
+    /**
+     * @brief 한 번만 시도
+     * @return false: writer 가 기록 중이었음 (out 은 변경될 수 있으나 사용하면 안 됨)
+     */
+    bool tryLoad(T& out) const {
+        const uint32_t before = seq_.load(std::memory_order_acquire);
+        if (before & 1u) return false;
+
+        data_.load(out);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq_.load(std::memory_order_relaxed) == before;
+    }
+
+    // 기록 횟수 x 2 (변경 감지용)
+    uint32_t version() const { return seq_.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<uint32_t> seq_{0};
+    SYNC::AtomicWords<T> data_;
+};
+
+} // namespace IPC
+} // namespace LIBCOMMON
+} // namespace GR
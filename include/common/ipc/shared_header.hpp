@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "common/sync/cache_line.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+namespace IPC {
+
+/**
+ * @brief SharedState 세그먼트 맨 앞에 위치하는 호환성 header
+ *
+ * 서로 다른 revision 의 shared_protocol.hpp 로 빌드된 프로세스가 같은 세그먼트를
+ * 다른 타입으로 해석하지 않도록 open() 시 magic / header 버전 / sizeof(T) / layout hash 를 검사한다.
+ *
+ * @note
+ * 1. magic 은 T 초기화와 나머지 필드 기록이 끝난 뒤 마지막에 release 로 게시된다.
+ *    magic 이 0 이면 아직 생성 중인 세그먼트다.
+ * 2. header 는 캐시 라인 하나를 차지하며 T 는 offset 64 부터 시작한다.
+ * 3. update_seq 는 SharedState::notify() 마다 증가하는 futex word 로, 변경 대기(waitForUpdate)에 사용한다.
+ * 4. retired 는 Owner 가 세그먼트를 unlink / 재생성할 때 기존 세그먼트에 설정된다.
+ *    (이미 매핑한 client 는 waitForUpdate() 에서 자동으로, 또는 isStale() 확인 후 refresh() 로 재연결)
+ * 5. 구조체 멤버만 바뀌고 크기 / 정렬 / 이름이 같은 변경은 hash 로 구분되지 않는다.
+ *    그런 변경 시에는 T 에 `static constexpr uint32_t LAYOUT_VERSION` 을 두고 올린다.
+ */
+struct alignas(SYNC::CACHE_LINE_SIZE) SharedHeader {
+    static constexpr uint32_t MAGIC = 0x47524950;  // "GRIP"
+    static constexpr uint32_t VERSION = 4;         // header 자체 레이아웃 버전
+
+    std::atomic<uint32_t> magic;
+    uint32_t header_version;
+    uint64_t payload_size;   // sizeof(T)
+    uint64_t layout_hash;    // layoutHash<T>()
+    std::atomic<uint32_t> update_seq;  // writer 변경 알림 카운터 (프로세스 간 futex word)
+    std::atomic<int32_t> owner_pid;    // 현재 소유 프로세스 (0: 없음). 살아있으면 attachOrCreate 가 거부
+    std::atomic<uint32_t> retired;     // 1: 이름이 삭제되었거나 새 세그먼트로 대체됨
+};
+
+static_assert(sizeof(SharedHeader) == SYNC::CACHE_LINE_SIZE, "SharedHeader must occupy one cache line");
+
+namespace detail {
+
+inline constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+inline constexpr uint64_t FNV_PRIME  = 0x100000001b3ULL;
+
+inline constexpr uint64_t fnvMix(uint64_t hash, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        hash ^= (value >> (i * 8)) & 0xFF;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// __PRETTY_FUNCTION__ 에서 "T = <타입명>" 부분만 hash (컴파일러별 접두어 차이 제거)
+template <typename T>
+constexpr uint64_t typeNameHash() {
+    const char* sig = __PRETTY_FUNCTION__;
+    std::size_t i = 0;
+    while (sig[i] != '\0' && !(sig[i] == 'T' && sig[i + 1] == ' ' && sig[i + 2] == '=' && sig[i + 3] == ' ')) ++i;
+    if (sig[i] != '\0') i += 4;
+
+    uint64_t hash = FNV_OFFSET;
+    for (; sig[i] != '\0' && sig[i] != ';' && sig[i] != ']'; ++i) {
+        hash ^= static_cast<uint8_t>(sig[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+template <typename T, typename = void>
+struct LayoutVersion : std::integral_constant<uint32_t, 0> {};
+
+template <typename T>
+struct LayoutVersion<T, std::void_t<decltype(T::LAYOUT_VERSION)>>
+    : std::integral_constant<uint32_t, static_cast<uint32_t>(T::LAYOUT_VERSION)> {};
+
+/**
+ * @brief 세그먼트 실제 배치: header 뒤에 T
+ */
+template <typename T>
+struct SharedSegment {
+    SharedHeader header;
+    T data;
+};
+
+} // namespace detail
+
+/**
+ * @brief 타입 T 의 compile-time layout hash (타입명, sizeof, alignof, T::LAYOUT_VERSION)
+ */
+template <typename T>
+constexpr uint64_t layoutHash() {
+    uint64_t hash = detail::typeNameHash<T>();
+    hash = detail::fnvMix(hash, sizeof(T));
+    hash = detail::fnvMix(hash, alignof(T));
+    hash = detail::fnvMix(hash, detail::LayoutVersion<T>::value);
+    return hash;
+}
+
+} // namespace IPC
+} // namespace LIBCOMMON
+} // namespace GR
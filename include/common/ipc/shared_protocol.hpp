@@ -1,7 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+
+#include "common/sync/cache_line.hpp"
 
 namespace GR {
 namespace LIBCOMMON {
@@ -9,7 +13,12 @@ namespace IPC {
     
 /**
  * 레이아웃 정렬을 위해 8바이트 단위로 설계
+ *
+ * 기록하는 프로세스가 다른 영역(Server -> Client / Client -> Server)은 alignas(SHM_CACHE_LINE) 로
+ * 캐시 라인을 분리한다. 한쪽의 주기적 store(heartbeat 등)가 상대가 읽는 라인을 무효화하지 않도록 하기 위함.
+ * 레이아웃이 바뀌면 SharedHeader 의 layout hash 가 달라지므로 서로 다른 revision 은 open() 에서 거부된다.
  */
+inline constexpr std::size_t SHM_CACHE_LINE = SYNC::CACHE_LINE_SIZE;
 
 
 // 공유 메모리 이름 정의
@@ -85,13 +94,13 @@ enum class SoundState : uint8_t {
 
 struct SoundIpcData {
     // 현재는 mq에서 제어하지만, 향후 확장 가능
-    struct Config {
+    struct alignas(SHM_CACHE_LINE) Config {
         std::atomic<uint8_t> master_volume;
         std::atomic<bool> mute_request;
         uint8_t reserved[6];
     };
 
-    struct Status {
+    struct alignas(SHM_CACHE_LINE) Status {
         std::atomic<SoundState> state;
         std::atomic<bool> is_active;
         uint8_t padding[6];
@@ -102,6 +111,10 @@ struct SoundIpcData {
     Status client_to_server;    // Sound Agent -> Domain Controller
 };
 
+static_assert(offsetof(SoundIpcData, server_to_client) == 0, "SoundIpcData layout");
+static_assert(offsetof(SoundIpcData, client_to_server) == SHM_CACHE_LINE, "client_to_server must start a new cache line");
+static_assert(sizeof(SoundIpcData) == 2 * SHM_CACHE_LINE, "SoundIpcData layout");
+
 // ============================================================
 // GPS 옵션 플래그
 // ============================================================
@@ -160,7 +173,8 @@ struct DeviceConfigTable {
 
     std::atomic<bool> ready;  // 서버 설정 완료 플래그
 
-    struct AgentStatus {
+    // Agent 가 기록하는 영역 (서버 설정 영역과 캐시 라인 분리)
+    struct alignas(SHM_CACHE_LINE) AgentStatus {
         std::atomic<bool> gps_ready;
         std::atomic<bool> imu_ready;
     } status;
@@ -171,6 +185,10 @@ struct DeviceConfigTable {
     }
 };
 
+static_assert(offsetof(DeviceConfigTable, status) % SHM_CACHE_LINE == 0, "AgentStatus must start a new cache line");
+static_assert(offsetof(DeviceConfigTable, status) >= offsetof(DeviceConfigTable, ready) + sizeof(std::atomic<bool>),
+              "DeviceConfigTable layout");
+
 namespace Utils {
 
     inline bool HasGpsOption(uint8_t currentOptions, GpsOption target) {
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "common/ipc/shared_state.hpp"
+#include "common/sync/cache_line.hpp"
+#include "common/sync/event_count.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+namespace IPC {
+
+/**
+ * @brief SharedRing 의 공유 메모리 레이아웃
+ *
+ * head(consumer) / tail(producer) / 대기 상태 / 슬롯을 각각 다른 캐시 라인에 둔다.
+ * index 는 프로세스 bit 수와 무관하도록 uint64_t 를 사용한다.
+ */
+template <typename T, std::size_t N>
+struct SharedRingData {
+    static_assert(std::is_trivially_copyable<T>::value, "SharedRing requires trivially copyable T");
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SharedRing capacity must be a power of two");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "SharedRing requires lock-free 64bit atomics");
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<uint64_t> head{0};  // consumer 만 기록
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<uint64_t> tail{0};  // producer 만 기록
+
+    alignas(SYNC::CACHE_LINE_SIZE) std::atomic<uint32_t> running{1};
+    SYNC::SharedEventCount not_empty;
+    SYNC::SharedEventCount not_full;
+
+    alignas(SYNC::CACHE_LINE_SIZE) T slots[N];
+};
+
+/**
+ * @brief SharedRing 에 연결하는 프로세스의 역할
+ */
+enum class RingRole : uint8_t {
+    PRODUCER = 0,
+    CONSUMER = 1
+};
+
+/**
+ * @brief 공유 메모리 기반 프로세스 간 lock-free single-producer / single-consumer 링
+ *
+ * SharedState 의 shm_open / mmap / header 검증을 그대로 사용한다.
+ * (IMU 샘플, RTCM 보정 데이터를 socket / POSIX MQ 없이 프로세스 간 전달)
+ *
+ * @tparam T trivially copyable 타입 (포인터 / std::string 등 프로세스 주소에 의존하는 멤버 금지)
+ * @tparam N 슬롯 수 (2의 거듭제곱)
+ *
+ * @note
+ * 1. 한 프로세스(스레드)가 producer, 다른 하나가 consumer 로만 사용해야 한다.
+ * 2. try_* / *_bulk 는 atomic 연산만 수행한다. futex 는 push() / pop() 으로 잠든 상대가
+ *    있을 때만 호출되므로, polling 하는 consumer 만 있으면 정상 경로에 syscall 이 없다.
+ * 3. 상대 index 는 프로세스 로컬에 캐시하여 가득 차거나 빌 때만 상대 캐시 라인을 읽는다.
+ * 4. 대기 상태(waiter 수)는 공유 메모리에 있으므로, push() / pop() 대기 중 kill 된 프로세스는 대기 수를 남긴다.
+ *    그동안 상대의 try_* 는 매번 FUTEX_WAKE 를 호출한다. 재시작한 프로세스가 같은 역할로 create() / open() 하면
+ *    자기 쪽 대기 수(producer: not_full, consumer: not_empty)를 0 으로 되돌려 syscall 없는 경로로 복구된다.
+ *    (SPSC 이므로 각 eventcount 의 대기자는 해당 역할 하나뿐)
+ *
+ * 사용 예시:
+ * ```cpp
+ * // producer (IMU 드라이버)
+ * SharedRing<ImuSample, 1024> ring;
+ * ring.create("/gr_imu_ring");
+ * ring.try_push(sample);
+ *
+ * // consumer (fusion 에이전트)
+ * SharedRing<ImuSample, 1024> ring;
+ * ring.open("/gr_imu_ring");
+ * ImuSample batch[64];
+ * std::size_t n = ring.try_pop_bulk(batch, 64);
+ * ```
+ */
+template <typename T, std::size_t N>
+class SharedRing {
+public:
+    using Data = SharedRingData<T, N>;
+
+    SharedRing() = default;
+    SharedRing(const SharedRing&) = delete;
+    SharedRing& operator=(const SharedRing&) = delete;
+
+    /**
+     * @param role 이 프로세스의 역할 (기본: 생성 측 producer / 연결 측 consumer). 자기 쪽 대기 상태를 초기화한다.
+     */
+    bool create(const std::string& shm_name, RingRole role = RingRole::PRODUCER) {
+        return attach(state_.create(shm_name), role);
+    }
+    bool open(const std::string& shm_name, RingRole role = RingRole::CONSUMER) {
+        return attach(state_.open(shm_name), role);
+    }
+    void close() { state_.close(); }
+    bool isInitialized() const { return state_.isInitialized(); }
+
+    bool try_push(const T& item) { return try_push_bulk(&item, 1) == 1; }
+
+    /**
+     * @brief producer 전용. 빈 공간만큼 items 를 한 번에 기록 (대기 없음)
+     * @return 기록한 개수
+     */
+    std::size_t try_push_bulk(const T* items, std::size_t count) {
+        Data& d = *state_;
+        const uint64_t tail = d.tail.load(std::memory_order_relaxed);
+        if (N - (tail - head_cache_) < count) {
+            head_cache_ = d.head.load(std::memory_order_acquire);
+        }
+        const std::size_t n = std::min<std::size_t>(count, N - (tail - head_cache_));
+        if (n == 0) return 0;
+
+        copyIn(d, tail, items, n);
+        d.tail.store(tail + n, std::memory_order_release);
+        d.not_empty.notifyOne();
+        return n;
+    }
+
+    bool try_pop(T& out) { return try_pop_bulk(&out, 1) == 1; }
+
+    /**
+     * @brief consumer 전용. 쌓인 item 을 최대 max 개 한 번에 복사 (대기 없음)
+     * @return 복사한 개수
+     */
+    std::size_t try_pop_bulk(T* out, std::size_t max) {
+        Data& d = *state_;
+        const uint64_t head = d.head.load(std::memory_order_relaxed);
+        if (tail_cache_ - head < max) {
+            tail_cache_ = d.tail.load(std::memory_order_acquire);
+        }
+        const std::size_t n = std::min<std::size_t>(max, tail_cache_ - head);
+        if (n == 0) return 0;
+
+        copyOut(d, head, out, n);
+        d.head.store(head + n, std::memory_order_release);
+        d.not_full.notifyOne();
+        return n;
+    }
+
+    /**
+     * @brief 공간이 생길 때까지 대기 후 기록
+     * @return false: stop() 으로 기록되지 않음
+     */
+    bool push(const T& item) {
+        Data& d = *state_;
+        for (;;) {
+            if (!d.running.load(std::memory_order_acquire)) return false;
+            if (try_push(item)) return true;
+
+            uint32_t key = d.not_full.prepareWait();
+            if (size() < N || !d.running.load(std::memory_order_acquire)) {
+                d.not_full.cancelWait();
+                continue;
+            }
+            d.not_full.wait(key);
+        }
+    }
+
+    /**
+     * @brief item 이 생길 때까지 대기
+     * stop() 이후 비어있으면 기본 생성된 T 반환 (SpscRing::pop 과 동일)
+     */
+    T pop() {
+        T item{};
+        while (!waitPop(item, std::chrono::steady_clock::time_point::max())) {
+            if (!state_->running.load(std::memory_order_acquire)) return T{};
+        }
+        return item;
+    }
+
+    template <typename Rep, typename Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+        T item;
+        if (waitPop(item, std::chrono::steady_clock::now() + timeout)) return item;
+        return std::nullopt;
+    }
+
+    /**
+     * @brief 양쪽 프로세스의 대기를 모두 해제. 이후 push 는 실패하고 pop 은 남은 item 만 반환
+     */
+    void stop() {
+        Data& d = *state_;
+        d.running.store(0, std::memory_order_release);
+        d.not_empty.notifyAll();
+        d.not_full.notifyAll();
+    }
+
+    // 대략적인 크기 (상대 프로세스가 동시에 변경 중일 수 있음)
+    std::size_t size() const {
+        const Data& d = *state_;
+        return static_cast<std::size_t>(d.tail.load(std::memory_order_acquire) - d.head.load(std::memory_order_acquire));
+    }
+
+    static constexpr std::size_t capacity() { return N; }
+
+private:
+    bool attach(bool ok, RingRole role) {
+        if (ok) {
+            head_cache_ = state_->head.load(std::memory_order_acquire);
+            tail_cache_ = state_->tail.load(std::memory_order_acquire);
+            // 같은 역할의 이전 프로세스가 대기 중 종료되었으면 남은 대기 수 정리
+            if (role == RingRole::PRODUCER) {
+                state_->not_full.resetWaiters();
+            } else {
+                state_->not_empty.resetWaiters();
+            }
+        }
+        return ok;
+    }
+
+    // stop() 으로 깨어났고 남은 item 이 없으면 false
+    bool waitPop(T& out, std::chrono::steady_clock::time_point deadline) {
+        Data& d = *state_;
+        for (;;) {
+            if (try_pop(out)) return true;
+            if (!d.running.load(std::memory_order_acquire)) return try_pop(out);
+
+            uint32_t key = d.not_empty.prepareWait();
+            if (size() > 0 || !d.running.load(std::memory_order_acquire)) {
+                d.not_empty.cancelWait();
+                continue;
+            }
+            if (deadline == std::chrono::steady_clock::time_point::max()) {
+                d.not_empty.wait(key);
+            } else if (!d.not_empty.waitUntil(key, deadline)) {
+                return try_pop(out);
+            }
+        }
+    }
+
+    static void copyIn(Data& d, uint64_t pos, const T* items, std::size_t n) {
+        const std::size_t start = static_cast<std::size_t>(pos & (N - 1));
+        const std::size_t first = std::min(n, N - start);
+        std::copy(items, items + first, d.slots + start);
+        std::copy(items + first, items + n, d.slots);
+    }
+
+    static void copyOut(const Data& d, uint64_t pos, T* out, std::size_t n) {
+        const std::size_t start = static_cast<std::size_t>(pos & (N - 1));
+        const std::size_t first = std::min(n, N - start);
+        std::copy(d.slots + start, d.slots + start + first, out);
+        std::copy(d.slots, d.slots + (n - first), out + first);
+    }
+
+    SharedState<Data> state_;
+    uint64_t head_cache_ = 0;  // producer 측 캐시
+    uint64_t tail_cache_ = 0;  // consumer 측 캐시
+};
+
+} // namespace IPC
+} // namespace LIBCOMMON
+} // namespace GR
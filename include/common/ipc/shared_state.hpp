@@ -1,18 +1,62 @@
 #pragma once
 
+#include <linux/magic.h>
+#include <sys/inotify.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
 #include <unistd.h>
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <fstream>
 #include <string>
+#include <thread>
 #include <cstring>
 #include <iostream>
 
+#include "common/ipc/shared_header.hpp"
+#include "common/sync/futex.hpp"
+
 namespace GR {
 namespace LIBCOMMON {
 
 namespace IPC {
 
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23  // Linux 5.14+, 구버전 헤더 대응
+#endif
+
+/**
+ * @brief SharedState 매핑의 huge page 사용 방식
+ */
+enum class HugePagePolicy : uint8_t {
+    NONE        = 0,
+    TRANSPARENT = 1,  // madvise(MADV_HUGEPAGE) 힌트. shmem THP 가 꺼져 있으면 경고 후 기본 페이지 사용
+    EXPLICIT    = 2   // MAP_HUGETLB. /dev/shm 이 hugetlbfs 여야 하며 아니면 실패
+};
+
+/**
+ * @brief SharedState 매핑 옵션 (실시간 경로의 page fault jitter 제거용)
+ *
+ * @note
+ * 1. populate : 매핑 시 모든 페이지를 미리 fault (MAP_POPULATE, 쓰기 매핑은 MADV_POPULATE_WRITE 까지)
+ * 2. lock     : mlock 으로 reclaim 방지. RLIMIT_MEMLOCK 이 부족하면 실패 (필요 크기와 함께 출력)
+ * 3. read_only: PROT_READ 매핑 (순수 consumer 용). create() / attachOrCreate() / notify() 는 실패하며,
+ *               T 에 기록하면 SIGSEGV. waitForUpdate() / isStale() / SeqLocked::load() 는 사용 가능
+ * 4. huge page 는 2MB 이상의 큰 세그먼트에서만 의미가 있다.
+ */
+struct MapOptions {
+    bool populate = false;
+    bool lock = false;
+    HugePagePolicy huge_pages = HugePagePolicy::NONE;
+    bool read_only = false;
+};
+
 /**
  * @brief 프로세스 간 공유 메모리 기반 데이터 관리 템플릿 클래스
  *
@@ -21,12 +65,28 @@ namespace IPC {
  * 1. T 내부 멤버들은 스레드/프로세스 간 경합 방지를 위해 std::atomic 사용을 권장합니다.
  * 2. 생성자(Owner)는 create()를, 사용자(User)는 open()을 호출하여 연결합니다.
  * 3. operator-> 를 통해 구조체 내부 멤버에 직접 접근하여 store/load를 수행합니다.
+ * 4. 세그먼트 앞에 SharedHeader(64바이트)가 붙으며, open() 은 magic / 버전 / sizeof(T) /
+ *    layout hash 가 다르면 실패한다. (다른 revision 의 T 로 빌드된 프로세스 간 연결 차단)
+ * 5. writer 는 변경 후 notify() 를, reader 는 polling 대신 waitForUpdate() 를 호출한다.
+ * 6. Owner 재시작 시 상태를 유지하려면 create() 대신 attachOrCreate() 를 사용한다.
+ * 7. 부팅 시 Owner 보다 먼저 뜨는 에이전트는 재시도 루프 대신 openWait() 를 사용한다.
+ * 8. Owner 가 세그먼트를 다시 만들면 기존 매핑은 isStale() == true 가 된다. waitForUpdate() 는 새 세그먼트로
+ *    자동 재연결하며, polling 하는 client 는 refresh() 를 호출한다. 재연결 전까지 기존 매핑은 유효하다.
+ * 9. prefault / mlock / huge page / 읽기 전용 매핑은 생성자의 MapOptions 로 지정한다.
  *
  * 사용 예시:
  * ```cpp
  * SharedState<MyData> shm;
  * shm.open("/my_shm");
  * shm->some_atomic_value.store(10, std::memory_order_release);
+ * shm.notify();
+ *
+ * // 다른 프로세스
+ * while (running) {
+ *     if (shm.waitForUpdate(std::chrono::milliseconds(500))) {
+ *         apply(shm->some_atomic_value.load(std::memory_order_acquire));
+ *     }
+ * }
  * ```
  */
 template<typename T>
@@ -43,7 +103,11 @@ public:
     //     SharedData() : state(T{}) {}
     // };
 
-    SharedState() : shm_fd_(-1), data_ptr_(nullptr), is_owner_(false), shm_name_("") {}
+    SharedState() : SharedState(MapOptions()) {}
+
+    explicit SharedState(const MapOptions& options)
+        : shm_fd_(-1), segment_(nullptr), data_ptr_(nullptr), is_owner_(false), unlink_on_close_(false),
+          shm_name_(""), last_seen_seq_(0), options_(options), map_length_(sizeof(Segment)) {}
 
     ~SharedState() {
         cleanup();
@@ -58,14 +122,19 @@ public:
      */
     bool create(const std::string& shm_name) {
 
-        if(validateName(shm_name) == false) {
+        if(validateName(shm_name) == false || rejectReadOnly("create", shm_name) == false) {
             return false;
         }
         shm_name_ = shm_name;
 
         try {
 
-            // 기존 공유 메모리 삭제 (있으면)
+            if (resolveMapLength() == false) {
+                return false;
+            }
+
+            // 기존 공유 메모리 삭제 (있으면). 기존 세그먼트를 매핑한 client 가 감지하도록 retired 표시
+            retireExisting(shm_name_);
             shm_unlink(shm_name_.c_str());
 
             // 공유 메모리 생성 (서버가 생성 및 삭제 권한 가짐)
@@ -75,12 +144,13 @@ public:
                 return false;
             }
 
-            // 크기 설정
-            if (ftruncate(shm_fd_, sizeof(T)) < 0) {
-                std::cerr << "[SharedState] : ftruncate failed: " << std::strerror(errno) << std::endl;
-                ::close(shm_fd_);
-                shm_fd_ = -1;
-                return false;
+            // 생성자 (정리 책임). 이후 실패 경로의 cleanup() 은 게시 전 세그먼트를 retired 표시 후 unlink
+            is_owner_ = true;
+            unlink_on_close_ = true;
+
+            // 크기 설정 (header + T)
+            if (ftruncate(shm_fd_, map_length_) < 0) {
+                return handleInternalError("ftruncate");
             }
 
             // 메모리 맵핑
@@ -90,10 +160,9 @@ public:
 
             if (data_ptr_) {
                 new (data_ptr_) T(); // Placement new: 공유 메모리 위치에 객체 생성(초기화)
+                publishHeader();
             }
 
-            is_owner_ = true;  // 생성자 (정리 책임)
-
             std::cout << "[SharedState] : Created: " << shm_name_ << std::endl;
             return true;
 
@@ -104,6 +173,70 @@ public:
         }
     }
 
+    /**
+     * @brief 유효한 기존 세그먼트가 있으면 내용을 유지한 채 소유권을 넘겨받고, 없으면 새로 생성 (Owner 용)
+     *
+     * DCU 재시작 시 사용. 기존 세그먼트의 header(magic / 버전 / layout)가 유효하면 T 를 다시 생성하지 않으므로
+     * 이미 연결된 에이전트는 재초기화 없이 같은 매핑을 계속 사용한다.
+     * header 가 없거나 호환되지 않으면 create() 와 동일하게 새로 만든다.
+     *
+     * @note
+     * 1. 이 방식으로 연결 / 생성한 세그먼트는 close() / 소멸 시 shm_unlink 하지 않는다. 삭제는 remove() 로 한다.
+     * 1-1. header 의 owner_pid 프로세스가 아직 살아있으면 소유권을 가져오지 않고 실패한다. (writer 중복 방지)
+     *      Owner 는 close() / 소멸 시 owner_pid 를 0 으로 되돌린다.
+     * 2. 이전 Owner 가 기록 도중 종료되었을 수 있으므로 T 는 어느 시점의 값이든 유효한 상태여야 한다.
+     *    (여러 필드를 함께 갱신하는 영역은 SeqLocked 사용)
+     */
+    bool attachOrCreate(const std::string& shm_name) {
+
+        if(validateName(shm_name) == false || rejectReadOnly("attachOrCreate", shm_name) == false) {
+            return false;
+        }
+        shm_name_ = shm_name;
+
+        const OpenStep step = attachExisting();
+        if (step == OpenStep::OPENED) {
+            is_owner_ = true;
+            unlink_on_close_ = false;
+            std::cout << "[SharedState] : Attached (ownership taken): " << shm_name_ << std::endl;
+            return true;
+        }
+        if (step == OpenStep::FAILED) {
+            return false;  // 살아있는 Owner 가 있음 (기존 세그먼트 유지)
+        }
+
+        if (create(shm_name) == false) {
+            return false;
+        }
+        unlink_on_close_ = false;
+        return true;
+    }
+
+    /**
+     * @brief 세그먼트 이름 삭제 (attachOrCreate 로 유지한 세그먼트 정리용)
+     * 현재 매핑은 close() 전까지 유효하며, 이미 연결된 프로세스도 계속 접근할 수 있다.
+     */
+    bool remove() {
+        if (shm_name_.empty()) {
+            return false;
+        }
+        if (shm_fd_ >= 0 && !nameRefersToSegment()) {
+            std::cerr << "[SharedState] : " << shm_name_ << " now refers to another segment, not unlinking" << std::endl;
+            return false;
+        }
+        if (shm_unlink(shm_name_.c_str()) != 0) {
+            std::cerr << "[SharedState] : shm_unlink failed for " << shm_name_ << ": "
+                      << std::strerror(errno) << std::endl;
+            return false;
+        }
+        if (segment_) {
+            retire(segment_->header);
+        }
+        unlink_on_close_ = false;
+        std::cout << "[SharedState] : Memory unlinked: " << shm_name_ << std::endl;
+        return true;
+    }
+
     /**
      * @brief 기존 공유 메모리 연결 (User/Accessor 용)
      * 개별 에이전트에서 호출
@@ -118,18 +251,40 @@ public:
 
         try {
             // 기존 공유 메모리 열기 (생성 안함)
-            shm_fd_ = shm_open(shm_name_.c_str(), O_RDWR, 0666);
+            shm_fd_ = shm_open(shm_name_.c_str(), openFlags(), 0666);
             if (shm_fd_ < 0) {
                 std::cerr << "[SharedState] : shm_open failed: " << std::strerror(errno) << std::endl;
                 return false;
             }
 
+            is_owner_ = false;  // 생성자 아님 (정리 안함)
+
+            if (resolveMapLength() == false) {
+                return false;
+            }
+
+            // 크기가 다르면 다른 T 로 만든 세그먼트 (mmap 범위 밖 접근 방지를 위해 먼저 확인)
+            struct stat st;
+            if (fstat(shm_fd_, &st) < 0) {
+                return handleInternalError("fstat");
+            }
+            if (static_cast<size_t>(st.st_size) != map_length_) {
+                std::cerr << "[SharedState] : size mismatch for " << shm_name_ << ": segment "
+                          << st.st_size << " bytes, expected " << map_length_ << std::endl;
+                cleanup();
+                return false;
+            }
+
             // 메모리 맵핑
             if( mapMemory() == false) {
                 return false;
             }
 
-            is_owner_ = false;  // 생성자 아님 (정리 안함)
+            if (validateHeader() == false) {
+                cleanup();
+                return false;
+            }
+            last_seen_seq_ = segment_->header.update_seq.load(std::memory_order_acquire);
 
             std::cout << "[SharedState] : opened: " << shm_name_ << std::endl;
             return true;
@@ -154,6 +309,150 @@ public:
     T& operator*() { return *data_ptr_; }
     const T& operator*() const { return *data_ptr_; }
 
+    /**
+     * @brief 세그먼트가 생성되고 초기화가 게시될 때까지 대기 후 연결 (User/Accessor 용)
+     *
+     * sleep / 재시도 대신 /dev/shm 을 inotify 로 감시하다가 생성 즉시 매핑하고,
+     * Owner 가 T 초기화 후 header magic 을 게시하는 순간 futex 로 깨어난다.
+     * (inotify 를 쓸 수 없는 환경에서는 10ms 주기 확인으로 동작)
+     *
+     * @return true: 연결됨, false: timeout 또는 호환되지 않는 세그먼트
+     *
+     * @note 세그먼트 게시는 T 생성 완료를 의미한다. 서버의 설정 완료 플래그(예: DeviceConfigTable::ready)는
+     *       연결 후 waitForUpdate() 로 기다린다.
+     *
+     * 사용 예시:
+     * ```cpp
+     * SharedState<DeviceConfigTable> config;
+     * if (config.openWait(DEVICE_CONFIG_SHM_NAME, std::chrono::seconds(30))) {
+     *     while (!config->ready.load(std::memory_order_acquire)) {
+     *         config.waitForUpdate(std::chrono::seconds(1));
+     *     }
+     * }
+     * ```
+     */
+    template <typename Rep, typename Period>
+    bool openWait(const std::string& shm_name, const std::chrono::duration<Rep, Period>& timeout) {
+
+        if(validateName(shm_name) == false) {
+            return false;
+        }
+        shm_name_ = shm_name;
+        is_owner_ = false;
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        // 감시를 먼저 등록한 뒤 열기를 시도해야 그 사이의 생성을 놓치지 않음
+        const int watch_fd = openShmWatch();
+
+        bool opened = false;
+        for (;;) {
+            const OpenStep step = tryOpenPublished(deadline);
+            if (step != OpenStep::NOT_YET) {
+                opened = (step == OpenStep::OPENED);
+                break;
+            }
+            const auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::steady_clock::duration::zero()) {
+                std::cerr << "[SharedState] : openWait timed out: " << shm_name_ << std::endl;
+                break;
+            }
+            waitShmEvent(watch_fd, remaining);
+        }
+
+        if (watch_fd >= 0) {
+            ::close(watch_fd);
+        }
+        if (opened) {
+            last_seen_seq_ = segment_->header.update_seq.load(std::memory_order_acquire);
+            std::cout << "[SharedState] : opened: " << shm_name_ << std::endl;
+        }
+        return opened;
+    }
+
+    /**
+     * @brief 변경 게시 (writer 용)
+     * T 의 멤버를 기록한 뒤 호출하면 waitForUpdate() 로 대기 중인 모든 프로세스를 깨운다.
+     */
+    void notify() {
+        if (!segment_) return;
+        if (options_.read_only) {
+            std::cerr << "[SharedState] : notify() on read_only mapping ignored: " << shm_name_ << std::endl;
+            return;
+        }
+        std::atomic<uint32_t>& seq = segment_->header.update_seq;
+        seq.fetch_add(1, std::memory_order_release);
+        SYNC::futexWakeAll(seq, true);
+    }
+
+    /**
+     * @brief 마지막 확인 이후 notify() 가 호출될 때까지 대기 (reader 용)
+     * @return true: 변경 있음 (새 세그먼트로 재연결 포함), false: timeout
+     *
+     * @note
+     * 1. 확인 시점은 SharedState 객체마다 따로 기록된다. 대기 사이에 notify() 가 여러 번
+     *    호출되어도 한 번의 true 로 합쳐지므로, 깨어난 뒤에는 필요한 필드를 모두 다시 읽는다.
+     * 2. 매핑이 폐기(isStale)되면 같은 이름의 새 세그먼트가 게시될 때까지 (inotify) 대기 후 교체한다.
+     *    timeout 까지 새 세그먼트가 없으면 기존 매핑을 유지한 채 false. 미연결 상태에서도 timeout 만큼 대기한다.
+     */
+    template <typename Rep, typename Period>
+    bool waitForUpdate(const std::chrono::duration<Rep, Period>& timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        if (!segment_) {
+            std::this_thread::sleep_until(deadline);  // 호출 측 루프가 busy-spin 하지 않도록
+            return false;
+        }
+
+        for (;;) {
+            if (isStale()) {
+                if (remapUntil(deadline)) return true;
+                std::this_thread::sleep_until(deadline);  // 호환되지 않는 새 세그먼트 (오류는 출력됨)
+                return false;
+            }
+            std::atomic<uint32_t>& seq = segment_->header.update_seq;
+            const uint32_t current = seq.load(std::memory_order_acquire);
+            if (current != last_seen_seq_) {
+                last_seen_seq_ = current;
+                return true;
+            }
+            const auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::steady_clock::duration::zero()) return false;
+            SYNC::futexWaitFor(seq, current, std::chrono::duration_cast<std::chrono::nanoseconds>(remaining), true);
+        }
+    }
+
+    /**
+     * @brief 현재 매핑이 폐기된 세그먼트인지 확인 (atomic load 1회)
+     * Owner 가 create() 로 다시 만들었거나 close() / remove() 로 이름을 삭제한 경우 true.
+     * 폐기 시 update_seq 도 증가하므로 waitForUpdate() 로 대기 중이면 즉시 깨어난다.
+     */
+    bool isStale() const {
+        return segment_ != nullptr && segment_->header.retired.load(std::memory_order_acquire) != 0;
+    }
+
+    /**
+     * @brief 폐기된 매핑이면 같은 이름의 새 세그먼트로 교체 (client 용, 대기 없음)
+     * @return true: 유효한 매핑 보유 (교체했거나 원래 유효), false: 새 세그먼트가 아직 없음 (다시 호출)
+     *
+     * 새 세그먼트를 연 뒤에만 교체하므로, 실패해도 기존(폐기된) 매핑은 계속 읽을 수 있다.
+     *
+     * 사용 예시 (waitForUpdate 를 쓰지 않고 주기적으로 읽는 client):
+     * ```cpp
+     * if (shm.isStale()) {
+     *     shm.refresh();
+     * }
+     * ```
+     */
+    bool refresh() {
+        if (segment_ == nullptr) {
+            return false;
+        }
+        if (!isStale()) {
+            return true;
+        }
+        return remapUntil(std::chrono::steady_clock::now());
+    }
+
     /**
      * @brief 공유 메모리 리소스 해제
      */
@@ -171,8 +470,24 @@ public:
 
 private:
     void cleanup() {
-        if (data_ptr_) {
-            munmap(data_ptr_, sizeof(T));
+        const bool retire_on_close = is_owner_ && unlink_on_close_;
+        // 다른 Owner 가 같은 이름으로 재생성했으면 (이미 retired) 그 세그먼트의 이름을 지우지 않음
+        const bool unlink = retire_on_close && !shm_name_.empty() && nameRefersToSegment();
+        if (retire_on_close && !unlink && !shm_name_.empty()) {
+            std::cout << "[SharedState] : " << shm_name_ << " now refers to another segment, not unlinking" << std::endl;
+        }
+
+        if (segment_) {
+            if (retire_on_close) {
+                retire(segment_->header);
+            }
+            if (is_owner_ && !options_.read_only) {
+                // 다음 attachOrCreate() 가 소유권을 가져갈 수 있도록 해제
+                int32_t self = static_cast<int32_t>(getpid());
+                segment_->header.owner_pid.compare_exchange_strong(self, 0, std::memory_order_acq_rel);
+            }
+            munmap(segment_, map_length_);
+            segment_ = nullptr;
             data_ptr_ = nullptr;
         }
 
@@ -181,8 +496,8 @@ private:
             shm_fd_ = -1;
         }
 
-        // Server(creator)만 shm_unlink 수행
-        if (is_owner_ && !shm_name_.empty()) {
+        // Server(creator)만 shm_unlink 수행 (attachOrCreate 로 유지하는 세그먼트 제외)
+        if (unlink) {
             if (shm_unlink(shm_name_.c_str()) == 0) {
                 std::cout << "[SharedState] : Memory unlinked: " << shm_name_ << std::endl;
             } else {
@@ -190,6 +505,54 @@ private:
                           << std::strerror(errno) << std::endl;
             }
         }
+        is_owner_ = false;
+        unlink_on_close_ = false;
+    }
+
+    // retired 설정 후 waitForUpdate() / openWait() (게시 전 세그먼트의 magic) 대기자 깨움
+    static void retire(SharedHeader& header) {
+        header.retired.store(1, std::memory_order_release);
+        header.update_seq.fetch_add(1, std::memory_order_release);
+        SYNC::futexWakeAll(header.update_seq, true);
+        SYNC::futexWakeAll(header.magic, true);
+    }
+
+    // 이름이 아직 이 객체가 연 세그먼트를 가리키는지 (fd 와 /dev/shm 경로의 device / inode 비교)
+    bool nameRefersToSegment() const {
+        struct stat own;
+        struct stat named;
+        if (shm_fd_ < 0 || fstat(shm_fd_, &own) < 0) {
+            return false;
+        }
+        if (stat((std::string(SHM_DIR) + shm_name_).c_str(), &named) < 0) {
+            return false;
+        }
+        return own.st_dev == named.st_dev && own.st_ino == named.st_ino;
+    }
+
+    // 이름으로 남아있는 기존 세그먼트에 retired 표시 (T 와 무관하게 header 만 매핑)
+    static void retireExisting(const std::string& name) {
+        const int fd = shm_open(name.c_str(), O_RDWR, 0666);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(SharedHeader)) {
+            void* ptr = mmap(NULL, sizeof(SharedHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (ptr != MAP_FAILED) {
+                SharedHeader& header = *static_cast<SharedHeader*>(ptr);
+                const uint32_t magic = header.magic.load(std::memory_order_acquire);
+                if (magic == SharedHeader::MAGIC && header.header_version == SharedHeader::VERSION) {
+                    retire(header);
+                } else if (magic == 0) {
+                    // 게시 전에 버려진 세그먼트: openWait() 의 magic 대기자를 깨워 새 세그먼트로 넘어가게 함
+                    header.retired.store(1, std::memory_order_release);
+                    SYNC::futexWakeAll(header.magic, true);
+                }
+                munmap(ptr, sizeof(SharedHeader));
+            }
+        }
+        ::close(fd);
     }
 
     bool handleInternalError(const std::string& msg) {
@@ -199,9 +562,290 @@ private:
     }
 
     bool mapMemory() {
-        void* ptr = mmap(NULL, sizeof(T), PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd_, 0);
+        const int prot = options_.read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+        int flags = MAP_SHARED;
+        if (options_.populate) flags |= MAP_POPULATE;
+        if (options_.huge_pages == HugePagePolicy::EXPLICIT) flags |= MAP_HUGETLB;
+
+        void* ptr = mmap(NULL, map_length_, prot, flags, shm_fd_, 0);
         if (ptr == MAP_FAILED) return handleInternalError("mmap");
-        data_ptr_ = static_cast<T*>(ptr);
+        segment_ = static_cast<Segment*>(ptr);
+        data_ptr_ = &segment_->data;
+
+        if (options_.huge_pages == HugePagePolicy::TRANSPARENT) {
+            if (madvise(ptr, map_length_, MADV_HUGEPAGE) < 0) {
+                std::cerr << "[SharedState] : madvise(MADV_HUGEPAGE) failed: " << std::strerror(errno)
+                          << ", using base pages" << std::endl;
+            } else if (!shmemThpEnabled()) {
+                std::cerr << "[SharedState] : shmem THP disabled (" << SHMEM_THP_PATH
+                          << "), MADV_HUGEPAGE has no effect" << std::endl;
+            }
+        }
+
+        // MAP_POPULATE 는 공유 매핑을 읽기 fault 로만 채우므로 쓰기 매핑은 첫 store 의 fault 까지 제거
+        // (5.14 미만 커널은 EINVAL, MAP_POPULATE 만으로 동작)
+        if (options_.populate && !options_.read_only) {
+            madvise(ptr, map_length_, MADV_POPULATE_WRITE);
+        }
+
+        if (options_.lock && mlock(ptr, map_length_) < 0) {
+            const int err = errno;
+            struct rlimit limit;
+            getrlimit(RLIMIT_MEMLOCK, &limit);
+            std::cerr << "[SharedState] : mlock failed for " << shm_name_ << ": " << std::strerror(err)
+                      << " (RLIMIT_MEMLOCK " << limit.rlim_cur << " bytes, need " << map_length_ << ")" << std::endl;
+            cleanup();
+            return false;
+        }
+        return true;
+    }
+
+    // 세그먼트 크기 결정 (EXPLICIT huge page 는 hugetlbfs 페이지 크기로 올림)
+    bool resolveMapLength() {
+        map_length_ = sizeof(Segment);
+        if (options_.huge_pages != HugePagePolicy::EXPLICIT) {
+            return true;
+        }
+
+        struct statfs fs;
+        if (statfs(SHM_DIR, &fs) < 0) {
+            return handleInternalError("statfs");
+        }
+        if (fs.f_type != HUGETLBFS_MAGIC) {
+            std::cerr << "[SharedState] : HugePagePolicy::EXPLICIT requires " << SHM_DIR
+                      << " on hugetlbfs (MAP_HUGETLB is not supported on tmpfs), use TRANSPARENT" << std::endl;
+            cleanup();
+            return false;
+        }
+        const size_t page = static_cast<size_t>(fs.f_bsize);
+        map_length_ = (sizeof(Segment) + page - 1) / page * page;
+        return true;
+    }
+
+    static bool shmemThpEnabled() {
+        std::ifstream file(SHMEM_THP_PATH);
+        std::string mode;
+        std::getline(file, mode);
+        return mode.find("[never]") == std::string::npos && mode.find("[deny]") == std::string::npos;
+    }
+
+    bool rejectReadOnly(const char* op, const std::string& name) const {
+        if (options_.read_only) {
+            std::cerr << "[SharedState] : " << op << " is not allowed with read_only mapping: " << name << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    int openFlags() const {
+        return options_.read_only ? O_RDONLY : O_RDWR;
+    }
+
+    // T 초기화 후 호출. magic 을 마지막에 게시하여 open() 측이 초기화 완료를 확인
+    void publishHeader() {
+        SharedHeader& header = segment_->header;
+        header.header_version = SharedHeader::VERSION;
+        header.payload_size = sizeof(T);
+        header.layout_hash = layoutHash<T>();
+        header.owner_pid.store(static_cast<int32_t>(getpid()), std::memory_order_relaxed);
+        header.magic.store(SharedHeader::MAGIC, std::memory_order_release);
+        SYNC::futexWakeAll(header.magic, true);  // openWait() 대기자
+    }
+
+    enum class OpenStep { OPENED, NOT_YET, FAILED };
+
+    // openWait 용: 한 번 열기 시도. 세그먼트는 있으나 미게시면 deadline 까지 magic 게시를 대기
+    template <typename Deadline>
+    OpenStep tryOpenPublished(const Deadline& deadline) {
+        shm_fd_ = shm_open(shm_name_.c_str(), openFlags(), 0666);
+        if (shm_fd_ < 0) {
+            if (errno == ENOENT) {
+                return OpenStep::NOT_YET;
+            }
+            std::cerr << "[SharedState] : shm_open failed: " << std::strerror(errno) << std::endl;
+            return OpenStep::FAILED;
+        }
+
+        struct stat st;
+        if (fstat(shm_fd_, &st) < 0) {
+            handleInternalError("fstat");
+            return OpenStep::FAILED;
+        }
+        if (st.st_size == 0) {
+            cleanup();  // shm_open 직후, ftruncate 전 (IN_MODIFY 로 다시 깨어남)
+            return OpenStep::NOT_YET;
+        }
+        if (resolveMapLength() == false) {
+            return OpenStep::FAILED;
+        }
+        if (static_cast<size_t>(st.st_size) != map_length_) {
+            std::cerr << "[SharedState] : size mismatch for " << shm_name_ << ": segment "
+                      << st.st_size << " bytes, expected " << map_length_ << std::endl;
+            cleanup();
+            return OpenStep::FAILED;
+        }
+
+        if (mapMemory() == false) {
+            return OpenStep::FAILED;
+        }
+
+        std::atomic<uint32_t>& magic = segment_->header.magic;
+        while (magic.load(std::memory_order_acquire) == 0 && !isStale()) {
+            const auto remaining = deadline - std::chrono::steady_clock::now();
+            if (!SYNC::futexWaitFor(magic, 0, std::chrono::duration_cast<std::chrono::nanoseconds>(remaining), true)) {
+                break;
+            }
+        }
+
+        if (magic.load(std::memory_order_acquire) == 0 || isStale()) {
+            cleanup();  // 아직 게시 전 (timeout) 이거나 곧 대체될 세그먼트
+            return OpenStep::NOT_YET;
+        }
+        if (validateHeader() == false) {
+            cleanup();
+            return OpenStep::FAILED;
+        }
+        return OpenStep::OPENED;
+    }
+
+    // 폐기된 매핑을 같은 이름의 새 세그먼트로 교체. 새 세그먼트를 연 뒤에만 교체하여 실패 시 기존 매핑 유지
+    bool remapUntil(std::chrono::steady_clock::time_point deadline) {
+        if (is_owner_ || shm_name_.empty()) {
+            return false;
+        }
+
+        SharedState next(options_);
+        next.shm_name_ = shm_name_;
+        const int watch_fd = deadline > std::chrono::steady_clock::now() ? openShmWatch() : -1;
+
+        bool opened = false;
+        for (;;) {
+            const OpenStep step = next.tryOpenPublished(deadline);
+            if (step != OpenStep::NOT_YET) {
+                opened = (step == OpenStep::OPENED);
+                break;
+            }
+            const auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::steady_clock::duration::zero()) {
+                break;
+            }
+            waitShmEvent(watch_fd, remaining);
+        }
+
+        if (watch_fd >= 0) {
+            ::close(watch_fd);
+        }
+        if (!opened) {
+            return false;
+        }
+
+        // 매핑 교체. 기존 매핑은 next 소멸 시 munmap (owner 가 아니므로 unlink 없음)
+        std::swap(shm_fd_, next.shm_fd_);
+        std::swap(segment_, next.segment_);
+        std::swap(data_ptr_, next.data_ptr_);
+        std::swap(map_length_, next.map_length_);
+        last_seen_seq_ = segment_->header.update_seq.load(std::memory_order_acquire);
+        std::cout << "[SharedState] : remapped: " << shm_name_ << std::endl;
+        return true;
+    }
+
+    // /dev/shm 생성 / 변경 감시용 inotify fd (불가 시 -1, waitShmEvent 가 sleep 으로 대체)
+    static int openShmWatch() {
+        int watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (watch_fd >= 0 && inotify_add_watch(watch_fd, SHM_DIR, IN_CREATE | IN_MOVED_TO | IN_MODIFY) < 0) {
+            ::close(watch_fd);
+            watch_fd = -1;
+        }
+        return watch_fd;
+    }
+
+    // /dev/shm 변경 또는 remaining 경과까지 대기 (inotify 불가 시 짧은 sleep)
+    static void waitShmEvent(int watch_fd, std::chrono::steady_clock::duration remaining) {
+        if (watch_fd < 0) {
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(remaining, std::chrono::milliseconds(10)));
+            return;
+        }
+        struct pollfd pfd = {watch_fd, POLLIN, 0};
+        const auto ms = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+        if (poll(&pfd, 1, static_cast<int>(ms)) > 0) {
+            alignas(struct inotify_event) char buffer[4096];
+            while (read(watch_fd, buffer, sizeof(buffer)) > 0) {
+                // 이벤트 내용은 보지 않고 다시 열기를 시도
+            }
+        }
+    }
+
+    // attachOrCreate 용: 기존 세그먼트가 있고 유효하면 매핑 (실패 시 unlink 없이 정리)
+    // OPENED: 소유권 획득, NOT_YET: 없거나 호환 안됨 (새로 생성), FAILED: 살아있는 Owner 가 있음
+    OpenStep attachExisting() {
+        is_owner_ = false;
+
+        shm_fd_ = shm_open(shm_name_.c_str(), O_RDWR, 0666);
+        if (shm_fd_ < 0) {
+            return OpenStep::NOT_YET;
+        }
+
+        if (resolveMapLength() == false) {
+            return OpenStep::NOT_YET;
+        }
+
+        struct stat st;
+        if (fstat(shm_fd_, &st) < 0 || static_cast<size_t>(st.st_size) != map_length_) {
+            std::cerr << "[SharedState] : existing " << shm_name_ << " is incompatible, recreating" << std::endl;
+            cleanup();
+            return OpenStep::NOT_YET;
+        }
+
+        if (mapMemory() == false) {
+            return OpenStep::NOT_YET;
+        }
+
+        if (validateHeader() == false) {
+            std::cerr << "[SharedState] : recreating " << shm_name_ << std::endl;
+            cleanup();
+            return OpenStep::NOT_YET;
+        }
+
+        // 이전 Owner 가 종료된 경우에만 교체. CAS 로 동시에 재시작한 Owner 끼리도 하나만 성공
+        std::atomic<int32_t>& owner = segment_->header.owner_pid;
+        int32_t previous = owner.load(std::memory_order_acquire);
+        const int32_t self = static_cast<int32_t>(getpid());
+        if ((previous != 0 && previous != self && isProcessAlive(previous)) ||
+            !owner.compare_exchange_strong(previous, self, std::memory_order_acq_rel)) {
+            std::cerr << "[SharedState] : " << shm_name_ << " is still owned by live process "
+                      << owner.load(std::memory_order_acquire) << std::endl;
+            cleanup();
+            return OpenStep::FAILED;
+        }
+
+        last_seen_seq_ = segment_->header.update_seq.load(std::memory_order_acquire);
+        return OpenStep::OPENED;
+    }
+
+    // kill(pid, 0): ESRCH 가 아니면 (권한 없음 EPERM 포함) 살아있는 것으로 간주
+    static bool isProcessAlive(int32_t pid) {
+        return kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+    }
+
+    bool validateHeader() const {
+        const SharedHeader& header = segment_->header;
+        const uint32_t magic = header.magic.load(std::memory_order_acquire);
+        if (magic != SharedHeader::MAGIC) {
+            std::cerr << "[SharedState] : " << shm_name_ << (magic == 0 ? " is not initialized yet" : " has invalid magic")
+                      << std::endl;
+            return false;
+        }
+        if (header.header_version != SharedHeader::VERSION) {
+            std::cerr << "[SharedState] : header version mismatch for " << shm_name_ << ": "
+                      << header.header_version << " != " << SharedHeader::VERSION << std::endl;
+            return false;
+        }
+        if (header.payload_size != sizeof(T) || header.layout_hash != layoutHash<T>()) {
+            std::cerr << "[SharedState] : layout mismatch for " << shm_name_ << " (size " << header.payload_size
+                      << " / " << sizeof(T) << ", hash 0x" << std::hex << header.layout_hash << " / 0x"
+                      << layoutHash<T>() << std::dec << ")" << std::endl;
+            return false;
+        }
         return true;
     }
 
@@ -213,10 +857,20 @@ private:
         return true;
     }
 
+    using Segment = detail::SharedSegment<T>;
+
+    static constexpr const char* SHM_DIR = "/dev/shm";  // glibc shm_open 경로
+    static constexpr const char* SHMEM_THP_PATH = "/sys/kernel/mm/transparent_hugepage/shmem_enabled";
+
     int shm_fd_;
-    T* data_ptr_;
+    Segment* segment_;  // 매핑 시작 주소 (header)
+    T* data_ptr_;       // &segment_->data
     bool is_owner_;  // 공유 메모리 생성자 여부 (서버만 true)
+    bool unlink_on_close_;  // 정리 시 shm_unlink 여부 (create() 만 true)
     std::string shm_name_;  // 공유 메모리 이름
+    uint32_t last_seen_seq_;  // waitForUpdate() 가 마지막으로 확인한 update_seq
+    MapOptions options_;
+    size_t map_length_;       // 매핑 / 세그먼트 크기 (보통 sizeof(Segment))
 };
 
 } // namespace IPC
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace GR {
+namespace LIBCOMMON {
+namespace SYNC {
+
+/**
+ * @brief trivially copyable T 를 8바이트 relaxed atomic word 배열로 저장
+ *
+ * seqlock 방식(기록 중 표시 sequence + 재검증)으로 읽을 때, 기록과 동시에 복사하더라도
+ * 일반 memcpy 와 달리 data race(UB)가 되지 않도록 한다. 순서 보장은 호출 측 sequence / fence 가 담당.
+ * (SeqLocked, BroadcastRing OVERWRITE 슬롯에서 사용)
+ */
+template <typename T>
+class AtomicWords {
+    static_assert(std::is_trivially_copyable<T>::value, "AtomicWords requires trivially copyable T");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "AtomicWords requires lock-free 64bit atomics");
+
+public:
+    static constexpr std::size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    AtomicWords() = default;  // 0 으로 초기화
+
+    explicit AtomicWords(const T& value) {
+        store(value);
+    }
+
+    AtomicWords(const AtomicWords&) = delete;
+    AtomicWords& operator=(const AtomicWords&) = delete;
+
+    void store(const T& value) {
+        uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, static_cast<const void*>(&value), sizeof(T));
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    void load(T& out) const {
+        uint64_t buffer[WORDS];
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::memcpy(static_cast<void*>(&out), buffer, sizeof(T));
+    }
+
+private:
+    std::atomic<uint64_t> words_[WORDS] = {};
+};
+
+} // namespace SYNC
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace GR {
+namespace LIBCOMMON {
+namespace SYNC {
+
+/**
+ * @brief false sharing 방지용 캐시 라인 크기
+ *
+ * Cortex-A53 / x86_64 모두 64바이트.
+ * std::hardware_destructive_interference_size 는 Yocto SDK(GCC 11) 에서 지원되지 않아 상수로 고정
+ */
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+} // namespace SYNC
+} // namespace LIBCOMMON
+} // namespace GR
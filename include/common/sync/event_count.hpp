@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "common/sync/futex.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+namespace SYNC {
+
+/**
+ * @brief lock-free 자료구조용 대기/깨움 도구 (eventcount)
+ *
+ * 대기자가 없으면 notify 는 fence + load 만 수행하고 syscall 을 하지 않는다.
+ *
+ * 사용 예시 (consumer):
+ * ```cpp
+ * while (!queue.try_pop(item)) {
+ *     uint32_t key = ec.prepareWait();
+ *     if (queue.try_pop(item)) { ec.cancelWait(); break; }
+ *     ec.wait(key);
+ * }
+ * ```
+ * producer 는 데이터를 게시한 뒤 ec.notifyOne() 호출
+ *
+ * @tparam Shared true: 공유 메모리에 두고 프로세스 간 대기/깨움에 사용 (SharedEventCount)
+ */
+template <bool Shared>
+class BasicEventCount {
+public:
+    BasicEventCount() = default;
+    BasicEventCount(const BasicEventCount&) = delete;
+    BasicEventCount& operator=(const BasicEventCount&) = delete;
+
+    uint32_t prepareWait() {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_acquire);
+    }
+
+    void cancelWait() {
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void wait(uint32_t key) {
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            futexWait(epoch_, key, Shared);
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return false: timeout 까지 notify 없음
+     */
+    template <typename Clock, typename Duration>
+    bool waitUntil(uint32_t key, const std::chrono::time_point<Clock, Duration>& deadline) {
+        bool notified = true;
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            auto remain = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now());
+            if (!futexWaitFor(epoch_, key, remain, Shared)) {
+                notified = epoch_.load(std::memory_order_acquire) != key;
+                break;
+            }
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return notified;
+    }
+
+    void notifyOne() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) return;
+        epoch_.fetch_add(1, std::memory_order_release);
+        futexWake(epoch_, 1, Shared);
+    }
+
+    void notifyAll() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) return;
+        epoch_.fetch_add(1, std::memory_order_release);
+        futexWakeAll(epoch_, Shared);
+    }
+
+    /**
+     * @brief 대기 수를 0 으로 되돌림 (대기 중 종료된 프로세스가 남긴 카운트 정리용)
+     *
+     * @note 이 eventcount 의 유일한 대기자가 호출자 자신이고 지금 대기 중이 아닐 때만 호출한다.
+     *       다른 대기자가 있으면 그 대기자는 notify 를 받지 못한다. (SharedRing 재연결 시 사용)
+     */
+    void resetWaiters() {
+        waiters_.store(0, std::memory_order_seq_cst);
+    }
+
+private:
+    std::atomic<uint32_t> epoch_{0};
+    std::atomic<uint32_t> waiters_{0};
+};
+
+using EventCount = BasicEventCount<false>;
+using SharedEventCount = BasicEventCount<true>;
+
+} // namespace SYNC
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#include <cerrno>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace GR {
+namespace LIBCOMMON {
+namespace SYNC {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be 32bit");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "futex word must be lock-free");
+
+/*
+ * futex(2) 래퍼
+ *
+ * shared = false : 프로세스 내부 전용 (FUTEX_PRIVATE_FLAG, 더 빠름)
+ * shared = true  : 공유 메모리 상의 word 를 프로세스 간 대기/깨움에 사용
+ */
+namespace detail {
+    inline long futexCall(std::atomic<uint32_t>& word, int op, uint32_t val,
+                          const struct timespec* timeout, bool shared) {
+        if (!shared) op |= FUTEX_PRIVATE_FLAG;
+        return ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), op, val, timeout, nullptr, 0);
+    }
+}
+
+/**
+ * @brief word 값이 expected 인 동안 대기
+ * @return true: 깨어남 / 값 불일치 / 시그널, false: timeout
+ */
+inline bool futexWait(std::atomic<uint32_t>& word, uint32_t expected, bool shared = false) {
+    detail::futexCall(word, FUTEX_WAIT, expected, nullptr, shared);
+    return true;
+}
+
+inline bool futexWaitFor(std::atomic<uint32_t>& word, uint32_t expected,
+                         std::chrono::nanoseconds timeout, bool shared = false) {
+    if (timeout.count() <= 0) return false;
+
+    struct timespec ts;
+    ts.tv_sec  = static_cast<time_t>(timeout.count() / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000LL);
+
+    if (detail::futexCall(word, FUTEX_WAIT, expected, &ts, shared) < 0 && errno == ETIMEDOUT) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief word 에서 대기 중인 스레드/프로세스를 최대 count 개 깨움
+ */
+inline void futexWake(std::atomic<uint32_t>& word, int count, bool shared = false) {
+    detail::futexCall(word, FUTEX_WAKE, static_cast<uint32_t>(count), nullptr, shared);
+}
+
+inline void futexWakeAll(std::atomic<uint32_t>& word, bool shared = false) {
+    futexWake(word, INT32_MAX, shared);
+}
+
+} // namespace SYNC
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "common/sync/futex.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+namespace SYNC {
+
+/**
+ * SafeQueue consumer 대기 전략
+ *
+ * 모든 전략은 std::condition_variable 과 같은 형태를 가진다.
+ *   - wait(lock, pred)
+ *   - wait_until(lock, deadline, pred) -> bool
+ *   - notify_one() / notify_all()
+ *
+ * BlockingWait      : 기존 동작. 즉시 futex sleep (CPU 사용 최소)
+ * SpinThenFutexWait : SpinCount 만큼 spin 후 futex sleep (짧은 간격으로 들어오는 item 의 wake-up 지연 감소)
+ * BusySpinWait      : sleep 없이 계속 spin (전용 core 에 고정된 consumer 전용)
+ */
+using BlockingWait = std::condition_variable;
+
+inline void cpuRelax() {
+#if defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+namespace detail {
+
+// 단일 core 에서는 spin 이 producer 실행만 늦추므로 바로 sleep 한다
+inline bool spinIsUseful() {
+    static const bool useful = std::thread::hardware_concurrency() > 1;
+    return useful;
+}
+
+/**
+ * @brief notify 마다 증가하는 sequence 를 lock 밖에서 관찰하는 대기 구현
+ *
+ * key 는 lock 을 잡은 상태에서 읽으므로, unlock 이후의 notify 는 반드시 sequence 변화로 보인다.
+ */
+template <int SpinCount, bool UseFutex>
+class SequenceWait {
+public:
+    template <typename Predicate>
+    void wait(std::unique_lock<std::mutex>& lock, Predicate pred) {
+        while (!pred()) {
+            const uint32_t key = seq_.load(std::memory_order_acquire);
+            lock.unlock();
+            if (UseFutex && !spinIsUseful()) {
+                sleep(key, nullptr);
+            } else if (!spin(key) && UseFutex) {
+                sleep(key, nullptr);
+            }
+            lock.lock();
+        }
+    }
+
+    template <typename Clock, typename Duration, typename Predicate>
+    bool wait_until(std::unique_lock<std::mutex>& lock,
+                    const std::chrono::time_point<Clock, Duration>& deadline, Predicate pred) {
+        while (!pred()) {
+            if (Clock::now() >= deadline) return pred();
+
+            const uint32_t key = seq_.load(std::memory_order_acquire);
+            lock.unlock();
+            if ((UseFutex && !spinIsUseful()) || (!spin(key, deadline) && UseFutex)) {
+                auto remain = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now());
+                sleep(key, &remain);
+            }
+            lock.lock();
+        }
+        return true;
+    }
+
+    void notify_one() {
+        seq_.fetch_add(1, std::memory_order_seq_cst);
+        if (UseFutex && sleepers_.load(std::memory_order_seq_cst) != 0) futexWake(seq_, 1);
+    }
+
+    void notify_all() {
+        seq_.fetch_add(1, std::memory_order_seq_cst);
+        if (UseFutex && sleepers_.load(std::memory_order_seq_cst) != 0) futexWakeAll(seq_);
+    }
+
+private:
+    // @return true: spin 중 notify 관찰
+    bool spin(uint32_t key) {
+        for (uint32_t i = 0; SpinCount < 0 || i < static_cast<uint32_t>(SpinCount); ++i) {
+            if (seq_.load(std::memory_order_acquire) != key) return true;
+            cpuRelax();
+        }
+        return false;
+    }
+
+    template <typename Clock, typename Duration>
+    bool spin(uint32_t key, const std::chrono::time_point<Clock, Duration>& deadline) {
+        for (uint32_t i = 0; SpinCount < 0 || i < static_cast<uint32_t>(SpinCount); ++i) {
+            if (seq_.load(std::memory_order_acquire) != key) return true;
+            // 시계 조회 비용을 줄이기 위해 일정 간격으로만 deadline 확인
+            if ((i & 0xFF) == 0xFF && Clock::now() >= deadline) return false;
+            cpuRelax();
+        }
+        return false;
+    }
+
+    void sleep(uint32_t key, const std::chrono::nanoseconds* timeout) {
+        sleepers_.fetch_add(1, std::memory_order_seq_cst);
+        if (seq_.load(std::memory_order_seq_cst) == key) {
+            if (timeout) futexWaitFor(seq_, key, *timeout);
+            else         futexWait(seq_, key);
+        }
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint32_t> seq_{0};
+    std::atomic<uint32_t> sleepers_{0};
+};
+
+} // namespace detail
+
+/**
+ * @tparam SpinCount futex sleep 전 spin 횟수 (1회 ≈ 수십 ns)
+ */
+template <int SpinCount = 4000>
+using SpinThenFutexWait = detail::SequenceWait<SpinCount, true>;
+
+using BusySpinWait = detail::SequenceWait<-1, false>;
+
+} // namespace SYNC
+} // namespace LIBCOMMON
+} // namespace GR
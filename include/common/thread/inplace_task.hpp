@@ -0,0 +1,116 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "common/container/safe_queue.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief heap 할당 없는 move-only void() callable
+ *
+ * 캡처를 내부 고정 버퍼에 저장한다. 버퍼보다 큰 캡처는 컴파일 에러가 난다.
+ * (std::function 은 libstdc++ 의 16바이트 small buffer 를 넘으면 heap 할당)
+ *
+ * @tparam Capacity 캡처 저장 버퍼 크기 (기본 48 -> 객체 전체 64바이트, 캐시 라인 1개)
+ *
+ * 사용 예시:
+ * ```cpp
+ * Task t([sample, &sink] { sink.write(sample); });
+ * t();
+ * ```
+ */
+template <std::size_t Capacity = 48>
+class InplaceTask {
+public:
+    static constexpr std::size_t CAPACITY = Capacity;
+
+    InplaceTask() noexcept = default;
+
+    template <typename F,
+              typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same<Fn, InplaceTask>::value>>
+    InplaceTask(F&& fn) {  // NOLINT: std::function 과 같은 암시적 변환 허용
+        static_assert(std::is_invocable_r<void, Fn&>::value, "InplaceTask requires a void() callable");
+        static_assert(sizeof(Fn) <= Capacity,
+                      "callable captures exceed InplaceTask capacity (capture less or use a larger InplaceTask<N>)");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "callable over-aligned for InplaceTask");
+        static_assert(std::is_nothrow_move_constructible<Fn>::value,
+                      "InplaceTask requires a nothrow move constructible callable");
+
+        new (&storage_) Fn(std::forward<F>(fn));
+        ops_ = &OPS<Fn>;
+    }
+
+    InplaceTask(InplaceTask&& other) noexcept {
+        moveFrom(other);
+    }
+
+    InplaceTask& operator=(InplaceTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceTask(const InplaceTask&) = delete;
+    InplaceTask& operator=(const InplaceTask&) = delete;
+
+    ~InplaceTask() {
+        reset();
+    }
+
+    void operator()() {
+        ops_->invoke(&storage_);
+    }
+
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(&storage_);
+            ops_ = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        void (*invoke)(void*);
+        void (*move)(void* dst, void* src) noexcept;  // src 는 move 후 파괴됨
+        void (*destroy)(void*) noexcept;
+    };
+
+    template <typename Fn>
+    static constexpr Ops OPS = {
+        [](void* p) { (*static_cast<Fn*>(p))(); },
+        [](void* dst, void* src) noexcept {
+            new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        },
+        [](void* p) noexcept { static_cast<Fn*>(p)->~Fn(); },
+    };
+
+    void moveFrom(InplaceTask& other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(&storage_, &other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    typename std::aligned_storage<Capacity, alignof(std::max_align_t)>::type storage_;
+    const Ops* ops_ = nullptr;
+};
+
+// 큐 / 스레드 풀 기본 task 타입
+using Task = InplaceTask<>;
+
+// warm-up 이후 push/pop 에 heap 할당이 없는 task 큐
+using TaskQueue = SafeQueue<Task, SYNC::BlockingWait, NoQueueStats, RingStorage>;
+
+} // namespace LIBCOMMON
+} // namespace GR
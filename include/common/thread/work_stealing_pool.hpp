@@ -0,0 +1,284 @@
+#pragma once
+#include <pthread.h>
+#include <sched.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/container/chase_lev_deque.hpp"
+#include "common/container/mpmc_queue.hpp"
+#include "common/sync/event_count.hpp"
+#include "common/thread/inplace_task.hpp"
+
+namespace GR {
+namespace LIBCOMMON {
+
+/**
+ * @brief worker 별 Chase-Lev deque 기반 work-stealing 스레드 풀
+ *
+ * @note
+ * 1. worker 스레드 안에서 submit 한 task 는 자기 deque 에 들어가며 (lock 없음, LIFO),
+ *    외부 스레드에서 submit 한 task 는 lock-free MPMC 주입 큐로 들어간다.
+ * 2. 할 일이 없는 worker 는 주입 큐 -> 다른 worker deque 순으로 steal 후 futex 로 sleep.
+ * 3. 소멸자(shutdown)는 남은 task 를 모두 실행한 뒤 worker 를 join 한다.
+ * 4. task 는 InplaceTask 로 저장되며, 주입 큐는 슬롯에 직접, worker deque 는 worker 가 소유한
+ *    node pool 을 사용하므로 warm-up 이후 post() 는 heap 할당을 하지 않는다.
+ *    (submit() 은 std::future 공유 상태 때문에 1회 할당)
+ *
+ * 사용 예시:
+ * ```cpp
+ * WorkStealingPool pool(4, {0, 1, 2, 3});   // worker i -> CPU i 고정
+ * auto f = pool.submit([](int x) { return x * 2; }, 21);
+ * pool.post([] { flushLogs(); });
+ * int v = f.get();
+ * ```
+ */
+class WorkStealingPool {
+public:
+    using Task = GR::LIBCOMMON::Task;
+
+    static constexpr std::size_t INJECT_QUEUE_CAPACITY = 4096;
+
+    /**
+     * @param threads      worker 수 (0 이면 hardware_concurrency)
+     * @param cpu_affinity worker i 를 cpu_affinity[i % size] 에 고정 (비어있으면 고정 안함)
+     */
+    explicit WorkStealingPool(std::size_t threads = 0, std::vector<int> cpu_affinity = {})
+        : injector_(INJECT_QUEUE_CAPACITY) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back(new Worker());
+        }
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_[i]->thread = std::thread([this, i] { run(i); });
+            if (!cpu_affinity.empty()) {
+                setAffinity(*workers_[i], cpu_affinity[i % cpu_affinity.size()]);
+            }
+        }
+    }
+
+    ~WorkStealingPool() {
+        shutdown();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief 결과가 필요 없는 task 실행 (예외는 로그 후 무시)
+     * @return false: shutdown 이후라 실행되지 않음
+     */
+    template <typename F>
+    bool post(F&& fn) {
+        return enqueue(Task(std::forward<F>(fn)));
+    }
+
+    /**
+     * @brief task 실행 후 결과 / 예외를 future 로 전달
+     * shutdown 이후 호출하면 future 는 broken_promise 예외를 가진다.
+     * fn / args 는 decay 복사(또는 move)되어 rvalue 로 호출된다. (move-only 인자 가능, std::bind 의 placeholder 해석 없음)
+     */
+    template <typename F, typename... Args>
+    auto submit(F&& fn, Args&&... args)
+        -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> {
+        using R = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+        auto task = std::make_shared<std::packaged_task<R()>>(
+            [fn = std::decay_t<F>(std::forward<F>(fn)),
+             bound = std::make_tuple(std::forward<Args>(args)...)]() mutable -> R {
+                return std::apply(std::move(fn), std::move(bound));
+            });
+        std::future<R> result = task->get_future();
+        enqueue(Task([task] { (*task)(); }));
+        return result;
+    }
+
+    /**
+     * @brief 새 task 거부, 남은 task 모두 실행 후 worker join
+     * worker 스레드 안에서 호출하면 안 된다.
+     */
+    void shutdown() {
+        if (running_.exchange(false, std::memory_order_acq_rel) == false) return;
+        idle_.notifyAll();
+        for (auto& worker : workers_) {
+            if (worker->thread.joinable()) worker->thread.join();
+        }
+        Task task;
+        while (injector_.try_pop(task)) {} // shutdown 경합으로 남은 task 폐기
+    }
+
+    std::size_t size() const { return workers_.size(); }
+
+private:
+    struct Worker;
+
+    struct TaskNode {
+        Task task;
+        TaskNode* next = nullptr;
+        Worker* owner = nullptr;
+    };
+
+    struct Worker {
+        static constexpr std::size_t NODE_CHUNK = 64;
+
+        ChaseLevDeque<TaskNode*> deque;
+        std::thread thread;
+        uint32_t rng = 0;
+
+        TaskNode* free_nodes = nullptr;              // owner 전용
+        std::atomic<TaskNode*> returned_nodes{nullptr}; // 다른 worker 가 steal 후 반환 (MPSC stack)
+        std::vector<std::unique_ptr<TaskNode[]>> chunks;
+
+        TaskNode* acquireNode() {
+            if (!free_nodes) {
+                free_nodes = returned_nodes.exchange(nullptr, std::memory_order_acquire);
+            }
+            if (!free_nodes) {
+                chunks.emplace_back(new TaskNode[NODE_CHUNK]);
+                TaskNode* chunk = chunks.back().get();
+                for (std::size_t i = 0; i < NODE_CHUNK; ++i) {
+                    chunk[i].owner = this;
+                    chunk[i].next = (i + 1 < NODE_CHUNK) ? &chunk[i + 1] : nullptr;
+                }
+                free_nodes = chunk;
+            }
+            TaskNode* node = free_nodes;
+            free_nodes = node->next;
+            return node;
+        }
+    };
+
+    static void releaseNode(TaskNode* node) {
+        Worker* owner = node->owner;
+        if (tls_worker_ == owner) {
+            node->next = owner->free_nodes;
+            owner->free_nodes = node;
+            return;
+        }
+        // push 만 하고 owner 는 exchange 로 통째로 가져가므로 ABA 문제 없음
+        TaskNode* head = owner->returned_nodes.load(std::memory_order_relaxed);
+        do {
+            node->next = head;
+        } while (!owner->returned_nodes.compare_exchange_weak(head, node, std::memory_order_release,
+                                                              std::memory_order_relaxed));
+    }
+
+    bool enqueue(Task&& task) {
+        if (tls_pool_ == this) {
+            // 실행 중인 task 가 만든 후속 task 는 shutdown 중에도 받아서 drain 대상에 포함
+            TaskNode* node = tls_worker_->acquireNode();
+            node->task = std::move(task);
+            tls_worker_->deque.push(node);
+        } else if (!running_.load(std::memory_order_acquire) || !injector_.push(std::move(task))) {
+            return false;
+        }
+        idle_.notifyOne();
+        return true;
+    }
+
+    void run(std::size_t index) {
+        Worker& self = *workers_[index];
+        tls_pool_ = this;
+        tls_worker_ = &self;
+        self.rng = static_cast<uint32_t>(index * 2654435761u) | 1u;
+
+        for (;;) {
+            Task task;
+            if (findTask(index, task)) {
+                execute(task);
+                continue;
+            }
+
+            uint32_t key = idle_.prepareWait();
+            if (hasPendingWork()) {
+                idle_.cancelWait();
+                continue;
+            }
+            if (!running_.load(std::memory_order_acquire)) {
+                idle_.cancelWait();
+                break;
+            }
+            idle_.wait(key);
+        }
+
+        tls_pool_ = nullptr;
+        tls_worker_ = nullptr;
+    }
+
+    bool findTask(std::size_t index, Task& task) {
+        Worker& self = *workers_[index];
+        TaskNode* node = nullptr;
+        if (self.deque.pop(node)) return takeNode(node, task);
+        if (injector_.try_pop(task)) return true;
+
+        // 임의 위치부터 다른 worker 순회
+        const std::size_t n = workers_.size();
+        self.rng ^= self.rng << 13;
+        self.rng ^= self.rng >> 17;
+        self.rng ^= self.rng << 5;
+        const std::size_t start = self.rng % n;
+        for (std::size_t k = 0; k < n; ++k) {
+            const std::size_t victim = (start + k) % n;
+            if (victim != index && workers_[victim]->deque.steal(node)) return takeNode(node, task);
+        }
+        return false;
+    }
+
+    static bool takeNode(TaskNode* node, Task& task) {
+        task = std::move(node->task);
+        releaseNode(node);
+        return true;
+    }
+
+    bool hasPendingWork() const {
+        if (injector_.size() != 0) return true;
+        for (const auto& worker : workers_) {
+            if (!worker->deque.empty()) return true;
+        }
+        return false;
+    }
+
+    static void execute(Task& task) {
+        try {
+            task();
+        } catch (const std::exception& e) {
+            std::cerr << "[WorkStealingPool] : task exception: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "[WorkStealingPool] : task exception: unknown" << std::endl;
+        }
+    }
+
+    static void setAffinity(Worker& worker, int cpu) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        int rc = pthread_setaffinity_np(worker.thread.native_handle(), sizeof(set), &set);
+        if (rc != 0) {
+            std::cerr << "[WorkStealingPool] : set affinity to CPU " << cpu << " failed: "
+                      << std::strerror(rc) << std::endl;
+        }
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    MpmcQueue<Task> injector_;
+    SYNC::EventCount idle_;
+    std::atomic<bool> running_{true};
+
+    static inline thread_local WorkStealingPool* tls_pool_ = nullptr;
+    static inline thread_local Worker* tls_worker_ = nullptr;
+};
+
+} // namespace LIBCOMMON
+} // namespace GR
@@ -0,0 +1,118 @@
+/**
+ * @brief warm-up 이후 heap 할당이 없어야 하는 경로 검증 (operator new 호출 횟수 집계)
+ *
+ * - SafeQueue<T, ..., RingStorage> push / pop
+ * - TaskQueue (InplaceTask) push / pop
+ * - WorkStealingPool::post
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "common/container/safe_queue.hpp"
+#include "common/thread/inplace_task.hpp"
+#include "common/thread/work_stealing_pool.hpp"
+
+namespace {
+std::atomic<long> g_allocations{0};
+
+void* countedAlloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void* countedAlignedAlloc(std::size_t size, std::align_val_t align) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t alignment = std::max(static_cast<std::size_t>(align), sizeof(void*));
+    void* p = nullptr;
+    if (posix_memalign(&p, alignment, size == 0 ? 1 : size) == 0) return p;
+    throw std::bad_alloc();
+}
+}
+
+// RingBuffer::grow 등은 aligned 버전을 호출하므로 모든 형태를 교체해야 집계된다
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void* operator new(std::size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+using namespace GR::LIBCOMMON;
+
+namespace {
+
+int g_failures = 0;
+
+// warm-up 에서 할당이 집계되지 않으면 operator new 교체가 동작하지 않는 것이므로 실패 처리
+void expectNoAllocation(const char* name, long warmup, long before) {
+    const long count = g_allocations.load() - before;
+    const bool ok = warmup > 0 && count == 0;
+    std::printf("[%s] %s: %ld allocations during warm-up, %ld after\n", ok ? "PASS" : "FAIL", name, warmup, count);
+    if (!ok) ++g_failures;
+}
+
+void testRingStorageQueue() {
+    const long start = g_allocations.load();
+    SafeQueue<int, SYNC::BlockingWait, NoQueueStats, RingStorage> queue;
+    for (int i = 0; i < 256; ++i) queue.push(i);  // warm-up: 최대 깊이까지 확장
+    while (queue.try_pop()) {}
+
+    const long before = g_allocations.load();
+    for (int round = 0; round < 1000; ++round) {
+        for (int i = 0; i < 256; ++i) queue.push(i);
+        for (int i = 0; i < 256; ++i) queue.pop();
+    }
+    expectNoAllocation("SafeQueue<RingStorage> push/pop", before - start, before);
+}
+
+void testTaskQueue() {
+    const long start = g_allocations.load();
+    TaskQueue queue;
+    long sum = 0;
+    for (int i = 0; i < 64; ++i) queue.push(Task([&sum, i] { sum += i; }));
+    while (auto task = queue.try_pop()) (*task)();
+
+    const long before = g_allocations.load();
+    for (int round = 0; round < 1000; ++round) {
+        for (int i = 0; i < 64; ++i) queue.push(Task([&sum, i] { sum += i; }));
+        for (int i = 0; i < 64; ++i) queue.pop()();
+    }
+    expectNoAllocation("TaskQueue push/pop", before - start, before);
+}
+
+void testPoolPost() {
+    const long start = g_allocations.load();
+    WorkStealingPool pool(2);
+    std::atomic<long> done{0};
+    auto runBatch = [&](long count) {
+        const long target = done.load() + count;
+        for (long i = 0; i < count; ++i) pool.post([&done] { done.fetch_add(1); });
+        while (done.load() < target) std::this_thread::yield();
+    };
+    runBatch(4096);  // warm-up: 노드 풀 / 주입 큐
+
+    const long before = g_allocations.load();
+    for (int round = 0; round < 100; ++round) runBatch(256);
+    expectNoAllocation("WorkStealingPool::post", before - start, before);
+    pool.shutdown();
+}
+
+} // namespace
+
+int main() {
+    testRingStorageQueue();
+    testTaskQueue();
+    testPoolPost();
+    return g_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}